@@ -1,8 +1,18 @@
-﻿namespace UnrealSharp.Binds;
+﻿using System.Runtime.InteropServices;
+
+namespace UnrealSharp.Binds;
 
 public static class NativeBinds
 {
+    [StructLayout(LayoutKind.Sequential)]
+    private unsafe struct BindsCallbacks
+    {
+        public delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr> GetBoundFunction;
+        public delegate* unmanaged[Cdecl]<char*, char*, int*, int, IntPtr*, int> GetBoundFunctions;
+    }
+    
     private unsafe static delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr> _getBoundFunction = null;
+    private unsafe static delegate* unmanaged[Cdecl]<char*, char*, int*, int, IntPtr*, int> _getBoundFunctions = null;
 
     public unsafe static void InitializeNativeBinds(IntPtr bindsCallbacks)
     {
@@ -11,7 +21,9 @@ public static class NativeBinds
             throw new Exception("NativeBinds.InitializeNativeBinds called twice");
         }
 
-        _getBoundFunction = (delegate* unmanaged[Cdecl]<char*, char*, int, IntPtr>)bindsCallbacks;
+        BindsCallbacks* callbacks = (BindsCallbacks*)bindsCallbacks;
+        _getBoundFunction = callbacks->GetBoundFunction;
+        _getBoundFunctions = callbacks->GetBoundFunctions;
     }
 
     public unsafe static IntPtr TryGetBoundFunction(string outerName, string functionName, int functionSize)
@@ -35,4 +47,41 @@ public static class NativeBinds
 
         return functionPtr;
     }
+
+    /// <summary>
+    /// Resolves all bound functions of an outer in a single native call.
+    /// </summary>
+    /// <param name="outerName">The name of the native outer the functions are exported from.</param>
+    /// <param name="functionNames">The function names, separated by null characters.</param>
+    /// <param name="functionSizes">The managed signature size of each function.</param>
+    /// <param name="outFunctions">Receives the resolved function pointers.</param>
+    /// <param name="numFunctions">The number of functions to resolve.</param>
+    public unsafe static void TryGetBoundFunctions(string outerName, string functionNames, int* functionSizes, IntPtr* outFunctions, int numFunctions)
+    {
+        if (_getBoundFunctions == null)
+        {
+            throw new Exception("NativeBinds not initialized");
+        }
+
+        int numResolved;
+        fixed (char* outerNamePtr = outerName)
+        fixed (char* functionNamesPtr = functionNames)
+        {
+            numResolved = _getBoundFunctions(outerNamePtr, functionNamesPtr, functionSizes, numFunctions, outFunctions);
+        }
+
+        if (numResolved == numFunctions)
+        {
+            return;
+        }
+
+        string[] names = functionNames.Split('\0');
+        for (int i = 0; i < numFunctions; i++)
+        {
+            if (outFunctions[i] == IntPtr.Zero)
+            {
+                throw new Exception($"Failed to find bound function {names[i]} in {outerName}");
+            }
+        }
+    }
 }
\ No newline at end of file
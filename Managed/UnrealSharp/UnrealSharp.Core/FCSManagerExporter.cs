@@ -9,6 +9,8 @@ public static unsafe partial class FCSManagerExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr> FindOrCreateManagedInterfaceWrapper;
     public static delegate* unmanaged<IntPtr> GetCurrentWorldContext;
     public static delegate* unmanaged<IntPtr> GetCurrentWorldPtr;
+    public static delegate* unmanaged<IntPtr> GetManagedObjectRemovalEpoch;
+    public static delegate* unmanaged<IntPtr, NativeBool> IsValidObject;
     
     public static UnrealSharpObject WorldContextObject
     {
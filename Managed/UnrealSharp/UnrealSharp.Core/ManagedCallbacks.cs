@@ -11,8 +11,14 @@ public unsafe struct ManagedCallbacks
     public delegate* unmanaged<IntPtr, void> ScriptManagerBridge_InvokeDelegate;
     public delegate* unmanaged<IntPtr, char*, IntPtr> ScriptManagerBridge_LookupManagedMethod;
     public delegate* unmanaged<IntPtr, char*, IntPtr> ScriptManagedBridge_LookupManagedType;
+    public delegate* unmanaged<IntPtr*, int, void> ScriptManagerBridge_InvokeDelegateBatch;
+    public delegate* unmanaged<IntPtr*, int, IntPtr, void> ScriptManagerBridge_ResetManagedObjectBatch;
+    public delegate* unmanaged<IntPtr, IntPtr, int> ScriptManagerBridge_RebindManagedObject;
+    public delegate* unmanaged<IntPtr, char**, int, IntPtr*, void> ScriptManagedBridge_LookupManagedTypes;
+    public delegate* unmanaged<IntPtr*, int, void> ScriptManagerBridge_InvalidateManagedObjectBatch;
     public delegate* unmanaged<IntPtr, IntPtr, void> ScriptManagedBridge_Dispose;
     public delegate* unmanaged<IntPtr, void> ScriptManagedBridge_FreeHandle;
+    public delegate* unmanaged<IntPtr*, int, IntPtr, void> ScriptManagedBridge_DisposeBatch;
 
     public static void Initialize(IntPtr outManagedCallbacks)
     {
@@ -24,8 +30,14 @@ public unsafe struct ManagedCallbacks
             ScriptManagerBridge_InvokeDelegate = &UnmanagedCallbacks.InvokeDelegate,
             ScriptManagerBridge_LookupManagedMethod = &UnmanagedCallbacks.LookupManagedMethod,
             ScriptManagedBridge_LookupManagedType = &UnmanagedCallbacks.LookupManagedType,
+            ScriptManagerBridge_InvokeDelegateBatch = &UnmanagedCallbacks.InvokeDelegateBatch,
+            ScriptManagerBridge_ResetManagedObjectBatch = &UnmanagedCallbacks.ResetManagedObjectBatch,
+            ScriptManagerBridge_RebindManagedObject = &UnmanagedCallbacks.RebindManagedObject,
+            ScriptManagedBridge_LookupManagedTypes = &UnmanagedCallbacks.LookupManagedTypes,
+            ScriptManagerBridge_InvalidateManagedObjectBatch = &UnmanagedCallbacks.InvalidateManagedObjectBatch,
             ScriptManagedBridge_Dispose = &UnmanagedCallbacks.Dispose,
             ScriptManagedBridge_FreeHandle = &UnmanagedCallbacks.FreeHandle,
+            ScriptManagedBridge_DisposeBatch = &UnmanagedCallbacks.DisposeBatch,
         };
     }
 }
\ No newline at end of file
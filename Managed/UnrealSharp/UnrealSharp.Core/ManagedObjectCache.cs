@@ -0,0 +1,54 @@
+﻿using System.Collections.Concurrent;
+
+namespace UnrealSharp.Core;
+
+/// <summary>
+/// Caches the handles of the C# counterparts of UObjects by native pointer, so marshalling the same objects again skips the native handle table.
+/// Entries are tagged with the removal epoch of the native handle table, which is bumped whenever handles are removed.
+/// An entry from an older epoch is never used, so a pointer that was freed and reused by another UObject can't resolve to a stale handle.
+/// Only the handle is cached. An object can be marked as garbage at any time, so a hit still does the native IsValid check of the uncached lookup.
+/// </summary>
+public static unsafe class ManagedObjectCache
+{
+    private readonly record struct Entry(IntPtr Handle, uint Epoch);
+    
+    private static readonly ConcurrentDictionary<IntPtr, Entry> Entries = new();
+    private static uint* _removalEpoch;
+    private static uint _entriesEpoch;
+
+    public static IntPtr FindManagedObject(IntPtr nativeObject)
+    {
+        uint epoch = Volatile.Read(ref *GetRemovalEpoch());
+        
+        if (Entries.TryGetValue(nativeObject, out Entry entry) && entry.Epoch == epoch)
+        {
+            return FCSManagerExporter.CallIsValidObject(nativeObject).ToManagedBool() ? entry.Handle : IntPtr.Zero;
+        }
+        
+        IntPtr handle = FCSManagerExporter.CallFindManagedObject(nativeObject);
+        
+        if (handle == IntPtr.Zero)
+        {
+            return handle;
+        }
+        
+        // Drop the entries of older epochs so the cache doesn't grow with every pointer ever seen.
+        if (Interlocked.Exchange(ref _entriesEpoch, epoch) != epoch)
+        {
+            Entries.Clear();
+        }
+        
+        Entries[nativeObject] = new Entry(handle, epoch);
+        return handle;
+    }
+
+    private static uint* GetRemovalEpoch()
+    {
+        if (_removalEpoch == null)
+        {
+            _removalEpoch = (uint*) FCSManagerExporter.CallGetManagedObjectRemovalEpoch();
+        }
+        
+        return _removalEpoch;
+    }
+}
\ No newline at end of file
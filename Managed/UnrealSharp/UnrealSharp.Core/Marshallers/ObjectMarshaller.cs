@@ -21,7 +21,7 @@ public static class ObjectMarshaller<T> where T : UnrealSharpObject
             return null!;
         }
         
-        IntPtr handle = FCSManagerExporter.CallFindManagedObject(uObjectPointer);
+        IntPtr handle = ManagedObjectCache.FindManagedObject(uObjectPointer);
         return GCHandleUtilities.GetObjectFromHandlePtr<T>(handle)!;
     }
 }
@@ -1,4 +1,5 @@
 ﻿using System.Reflection;
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using UnrealSharp.Core.Attributes;
 using UnrealSharp.Core.Marshallers;
@@ -7,6 +8,9 @@ namespace UnrealSharp.Core;
 
 public static class UnmanagedCallbacks
 {
+    // Generated types by full name, built once per assembly. Weakly keyed so collectible assemblies can still unload.
+    private static readonly ConditionalWeakTable<Assembly, Dictionary<string, Type>> GeneratedTypesByAssembly = new();
+    
     [UnmanagedCallersOnly]
     public static unsafe IntPtr CreateNewManagedObject(IntPtr nativeObject, IntPtr typeHandlePtr, char** error)
     {
@@ -142,9 +146,53 @@ public static class UnmanagedCallbacks
         }
     }
     
+    [UnmanagedCallersOnly]
+    public static unsafe void LookupManagedTypes(IntPtr assemblyHandle, char** fullTypeNames, int count, IntPtr* outTypeHandles)
+    {
+        try
+        {
+            Assembly? loadedAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
+
+            if (loadedAssembly == null)
+            {
+                throw new InvalidOperationException("The provided assembly handle does not point to a valid assembly.");
+            }
+
+            Dictionary<string, Type> generatedTypes = GetGeneratedTypes(loadedAssembly);
+
+            for (int i = 0; i < count; i++)
+            {
+                outTypeHandles[i] = generatedTypes.TryGetValue(new string(fullTypeNames[i]), out Type? type)
+                    ? GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(type, loadedAssembly))
+                    : IntPtr.Zero;
+            }
+        }
+        catch (Exception ex)
+        {
+            LogUnrealSharpCore.LogError($"Exception while trying to look up managed types: {ex.Message}");
+        }
+    }
+    
     private static IntPtr FindTypeInAssembly(Assembly assembly, string fullTypeName)
+    {
+        if (!GetGeneratedTypes(assembly).TryGetValue(fullTypeName, out Type? type))
+        {
+            return IntPtr.Zero;
+        }
+
+        return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(type, assembly));
+    }
+
+    private static Dictionary<string, Type> GetGeneratedTypes(Assembly assembly)
+    {
+        return GeneratedTypesByAssembly.GetValue(assembly, BuildGeneratedTypeIndex);
+    }
+
+    private static Dictionary<string, Type> BuildGeneratedTypeIndex(Assembly assembly)
     {
         Type[] types = assembly.GetTypes();
+        Dictionary<string, Type> generatedTypes = new Dictionary<string, Type>(types.Length);
+        
         foreach (Type type in types)
         {
             foreach (CustomAttributeData attributeData in type.CustomAttributes)
@@ -160,14 +208,11 @@ public static class UnmanagedCallbacks
                 }
 
                 string fullName = (string)attributeData.ConstructorArguments[1].Value!;
-                if (fullName == fullTypeName)
-                {
-                    return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(type, assembly));
-                }
+                generatedTypes.TryAdd(fullName, type);
             }
         }
 
-        return IntPtr.Zero;
+        return generatedTypes;
     }
     
     [UnmanagedCallersOnly]
@@ -211,7 +256,7 @@ public static class UnmanagedCallbacks
                 throw new Exception("Invalid delegate handle");
             }
 
-            foundDelegate.DynamicInvoke();
+            InvokeParameterless(foundDelegate);
         }
         catch (Exception ex)
         {
@@ -219,8 +264,144 @@ public static class UnmanagedCallbacks
         }
     }
 
+    [UnmanagedCallersOnly]
+    public static unsafe void InvokeDelegateBatch(IntPtr* delegateHandles, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            IntPtr delegateHandle = delegateHandles[i];
+            
+            try
+            {
+                Delegate? foundDelegate = GCHandleUtilities.GetObjectFromHandlePtr<Delegate>(delegateHandle);
+                
+                if (foundDelegate == null)
+                {
+                    throw new Exception("Invalid delegate handle");
+                }
+
+                InvokeParameterless(foundDelegate);
+            }
+            catch (Exception ex)
+            {
+                LogUnrealSharpCore.LogError($"Exception during InvokeDelegateBatch: {ex.Message}");
+            }
+            finally
+            {
+                DisposeHandle(delegateHandle, null);
+            }
+        }
+    }
+
+    // Async continuations and timers are plain Actions, call them directly instead of going through reflection.
+    private static void InvokeParameterless(Delegate foundDelegate)
+    {
+        if (foundDelegate is Action action)
+        {
+            action();
+            return;
+        }
+
+        foundDelegate.DynamicInvoke();
+    }
+
     [UnmanagedCallersOnly]
     public static void Dispose(IntPtr handle, IntPtr assemblyHandle)
+    {
+        Assembly? foundAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
+        DisposeHandle(handle, foundAssembly);
+    }
+
+    [UnmanagedCallersOnly]
+    public static unsafe void DisposeBatch(IntPtr* handles, int count, IntPtr assemblyHandle)
+    {
+        Assembly? foundAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
+        
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                DisposeHandle(handles[i], foundAssembly);
+            }
+            catch (Exception ex)
+            {
+                LogUnrealSharpCore.LogError($"Exception during DisposeBatch: {ex.Message}");
+            }
+        }
+    }
+
+    [UnmanagedCallersOnly]
+    public static unsafe void InvalidateManagedObjectBatch(IntPtr* handles, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                // Only clears the native object, the object is disposed when its handle is freed or reset for the pool.
+                GCHandleUtilities.GetObjectFromHandlePtr<UnrealSharpObject>(handles[i])?.Invalidate();
+            }
+            catch (Exception ex)
+            {
+                LogUnrealSharpCore.LogError($"Exception during InvalidateManagedObjectBatch: {ex.Message}");
+            }
+        }
+    }
+
+    [UnmanagedCallersOnly]
+    public static unsafe void ResetManagedObjectBatch(IntPtr* handles, int count, IntPtr assemblyHandle)
+    {
+        Assembly? foundAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
+        
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                UnrealSharpObject? managedObject = GCHandleUtilities.GetObjectFromHandlePtr<UnrealSharpObject>(handles[i]);
+                
+                if (managedObject == null)
+                {
+                    throw new Exception("Invalid managed object handle");
+                }
+                
+                // Same as a regular release, but the handle stays allocated so the object can be rebound later.
+                managedObject.Dispose();
+            }
+            catch (Exception ex)
+            {
+                LogUnrealSharpCore.LogError($"Exception during ResetManagedObjectBatch: {ex.Message}");
+                DisposeHandle(handles[i], foundAssembly);
+                handles[i] = IntPtr.Zero;
+            }
+        }
+    }
+
+    [UnmanagedCallersOnly]
+    public static int RebindManagedObject(IntPtr handle, IntPtr nativeObject)
+    {
+        UnrealSharpObject? managedObject = null;
+        
+        try
+        {
+            managedObject = GCHandleUtilities.GetObjectFromHandlePtr<UnrealSharpObject>(handle);
+            
+            if (managedObject == null)
+            {
+                throw new Exception("Invalid managed object handle");
+            }
+            
+            managedObject.Rebind(nativeObject);
+            return 1;
+        }
+        catch (Exception ex)
+        {
+            LogUnrealSharpCore.LogError($"Failed to rebind pooled managed object: {ex.Message}");
+            DisposeHandle(handle, managedObject?.GetType().Assembly);
+        }
+
+        return 0;
+    }
+
+    private static void DisposeHandle(IntPtr handle, Assembly? assembly)
     {
         GCHandle foundHandle = GCHandle.FromIntPtr(handle);
         
@@ -233,9 +414,8 @@ public static class UnmanagedCallbacks
         {
             disposable.Dispose();
         }
-
-        Assembly? foundAssembly = GCHandleUtilities.GetObjectFromHandlePtr<Assembly>(assemblyHandle);
-        GCHandleUtilities.Free(foundHandle, foundAssembly);
+        
+        GCHandleUtilities.Free(foundHandle, assembly);
     }
 
     [UnmanagedCallersOnly]
@@ -9,31 +9,93 @@ namespace UnrealSharp.Core;
 /// </summary>
 public class UnrealSharpObject : IDisposable
 {
+    /// <summary>
+    /// Creates the C# counterparts of one type, with the default constructor resolved once instead of on every creation.
+    /// </summary>
+    private sealed unsafe class Factory
+    {
+        public Factory(Type type)
+        {
+            Type = type;
+            Assembly = type.Assembly;
+            Constructor = FindDefaultConstructor(type);
+        }
+
+        public readonly Type Type;
+        public readonly Assembly Assembly;
+        public readonly delegate*<object, void> Constructor;
+    }
+
+    // Weakly keyed so the types of collectible assemblies can still unload.
+    private static readonly ConditionalWeakTable<Type, Factory> Factories = new();
+    
+    private static Factory GetFactory(Type type) => Factories.GetValue(type, static type => new Factory(type));
+
     internal static unsafe IntPtr Create(Type typeToCreate, IntPtr nativeObjectPtr)
     {
-        const BindingFlags bindingFlags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance;
-        ConstructorInfo? foundDefaultCtor = typeToCreate.GetConstructor(bindingFlags, Type.EmptyTypes);
+        Factory factory = GetFactory(typeToCreate);
             
-        if (foundDefaultCtor == null)
+        if (factory.Constructor == null)
         {
             LogUnrealSharpCore.LogError("Failed to find default constructor for type: " + typeToCreate.FullName);
             return IntPtr.Zero;
         }
             
-        delegate*<object, void> foundConstructor = (delegate*<object, void>) foundDefaultCtor.MethodHandle.GetFunctionPointer();
-            
-        UnrealSharpObject createdObject = (UnrealSharpObject) RuntimeHelpers.GetUninitializedObject(typeToCreate);
+        UnrealSharpObject createdObject = (UnrealSharpObject) RuntimeHelpers.GetUninitializedObject(factory.Type);
         createdObject.NativeObject = nativeObjectPtr;
             
-        foundConstructor(createdObject);
+        factory.Constructor(createdObject);
             
-        return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(createdObject, typeToCreate.Assembly));
+        return GCHandle.ToIntPtr(GCHandleUtilities.AllocateStrongPointer(createdObject, factory.Assembly));
+    }
+
+    /// <summary>
+    /// Binds a pooled object, released from a destroyed UObject, to a new UObject of the same class.
+    /// The default constructor runs again so field initializers reset the state of the previous object.
+    /// </summary>
+    internal unsafe void Rebind(IntPtr nativeObjectPtr)
+    {
+        Factory factory = GetFactory(GetType());
+        
+        if (factory.Constructor == null)
+        {
+            throw new InvalidOperationException("Failed to find default constructor for type: " + factory.Type.FullName);
+        }
+        
+        NativeObject = nativeObjectPtr;
+        Generation++;
+        factory.Constructor(this);
+    }
+
+    private static unsafe delegate*<object, void> FindDefaultConstructor(Type type)
+    {
+        const BindingFlags bindingFlags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance;
+        ConstructorInfo? foundDefaultCtor = type.GetConstructor(bindingFlags, Type.EmptyTypes);
+        
+        if (foundDefaultCtor == null)
+        {
+            return null;
+        }
+        
+        return (delegate*<object, void>) foundDefaultCtor.MethodHandle.GetFunctionPointer();
     }
     
     /// <summary>
     /// The pointer to the UObject that this C# object represents.
     /// </summary>
     public IntPtr NativeObject { get; private set; }
+
+    /// <summary>
+    /// Incremented every time a pooled C# object is bound to a new UObject, see UClassAttribute.ManagedObjectPoolSize.
+    /// Store it along with a reference to detect that the object has been reused since.
+    /// </summary>
+    public uint Generation { get; private set; }
+
+    // Called once the GC found the UObject unreachable, before its memory is freed, so nothing passes the pointer to native code afterwards.
+    internal void Invalidate()
+    {
+        NativeObject = IntPtr.Zero;
+    }
     
     /// <inheritdoc />
     public virtual void Dispose()
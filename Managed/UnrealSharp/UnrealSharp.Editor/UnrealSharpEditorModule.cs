@@ -21,6 +21,8 @@ public unsafe struct FManagedUnrealSharpEditorCallbacks
     public delegate* unmanaged<void> ForceManagedGC;
     public delegate* unmanaged<char*, IntPtr, NativeBool> OpenSolution;
     public delegate* unmanaged<char*, void> AddProjectToCollection;
+    public delegate* unmanaged<void> CancelBuild;
+    public delegate* unmanaged<void> ResetCancelBuild;
 
     public FManagedUnrealSharpEditorCallbacks()
     {
@@ -28,6 +30,8 @@ public unsafe struct FManagedUnrealSharpEditorCallbacks
         ForceManagedGC = &ManagedUnrealSharpEditorCallbacks.ForceManagedGC;
         OpenSolution = &ManagedUnrealSharpEditorCallbacks.OpenSolution;
         AddProjectToCollection = &ManagedUnrealSharpEditorCallbacks.AddProjectToCollection;
+        CancelBuild = &ManagedUnrealSharpEditorCallbacks.CancelBuild;
+        ResetCancelBuild = &ManagedUnrealSharpEditorCallbacks.ResetCancelBuild;
     }
 }
 
@@ -63,6 +67,9 @@ public static class ManagedUnrealSharpEditorCallbacks
     private static readonly ProjectCollection ProjectCollection = new();
     private static readonly BuildManager UnrealSharpBuildManager = new("UnrealSharpBuildManager");
 
+    // Set from the game thread while a background build runs on a worker thread.
+    private static volatile bool _cancelRequested;
+
     public static void Initialize()
     {
         FUnrealSharpEditorModuleExporter.CallGetProjectPaths(out UnmanagedArray projectPaths);
@@ -84,6 +91,12 @@ public static class ManagedUnrealSharpEditorCallbacks
     {
         try
         {
+            // A cancel sent before the build was submitted has nothing to cancel in the build manager.
+            if (_cancelRequested)
+            {
+                throw new OperationCanceledException("The build was cancelled.");
+            }
+            
             string buildConfigurationString = new string(buildConfiguration);
 
             if (buildSolution == NativeBool.True)
@@ -107,13 +120,38 @@ public static class ManagedUnrealSharpEditorCallbacks
                     null
                 );
 
-                BuildResult result = UnrealSharpBuildManager.Build(buildParameters, buildRequest);
+                BuildResult result;
+                UnrealSharpBuildManager.BeginBuild(buildParameters);
+                
+                try
+                {
+                    BuildSubmission submission = UnrealSharpBuildManager.PendBuildRequest(buildRequest);
+                    
+                    // CancelAllSubmissions does nothing before the build has begun, pass on a cancel that came in meanwhile.
+                    if (_cancelRequested)
+                    {
+                        UnrealSharpBuildManager.CancelAllSubmissions();
+                    }
+                    
+                    result = submission.Execute();
+                }
+                finally
+                {
+                    UnrealSharpBuildManager.EndBuild();
+                }
+                
                 if (result.OverallResult == BuildResultCode.Failure)
                 {
                     throw new Exception(logger.ErrorLog.ToString());
                 }
             }
 
+            // Don't weave the output of a build that is about to be replaced by a newer one.
+            if (_cancelRequested)
+            {
+                throw new OperationCanceledException("The build was cancelled.");
+            }
+
             Weave(outputPath, buildConfigurationString);
         }
         catch (Exception exception)
@@ -147,6 +185,19 @@ public static class ManagedUnrealSharpEditorCallbacks
         Program.Weave(weaverOptions);
     }
     
+    [UnmanagedCallersOnly]
+    public static void CancelBuild()
+    {
+        _cancelRequested = true;
+        UnrealSharpBuildManager.CancelAllSubmissions();
+    }
+    
+    [UnmanagedCallersOnly]
+    public static void ResetCancelBuild()
+    {
+        _cancelRequested = false;
+    }
+    
     [UnmanagedCallersOnly]
     public static void ForceManagedGC()
     {
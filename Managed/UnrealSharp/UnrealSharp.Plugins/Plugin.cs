@@ -26,13 +26,16 @@ public class Plugin
     public WeakReference? WeakRefAssembly { get; private set; }
     public List<IModuleInterface> ModuleInterfaces { get; } = [];
 
+    // Module types found when the assembly was loaded, started by StartModules on the game thread.
+    private readonly List<Type> _moduleTypes = [];
+
     public bool IsLoadContextAlive
     {
         [MethodImpl(MethodImplOptions.NoInlining)]
         get => WeakRefLoadContext != null && WeakRefLoadContext.IsAlive;
     }
 
-    public bool Load()
+    public bool Load(bool startModules = true)
     {
         if (LoadContext == null || (WeakRefAssembly != null && WeakRefAssembly.IsAlive))
         {
@@ -51,6 +54,22 @@ public class Plugin
                 continue;
             }
 
+            _moduleTypes.Add(type);
+        }
+
+        if (startModules)
+        {
+            StartModules();
+        }
+
+        return true;
+    }
+
+    // Module startup runs user code, so unlike Load it has to be called from the game thread.
+    public void StartModules()
+    {
+        foreach (Type type in _moduleTypes)
+        {
             if (Activator.CreateInstance(type) is not IModuleInterface moduleInterface)
             {
                 continue;
@@ -60,7 +79,7 @@ public class Plugin
             ModuleInterfaces.Add(moduleInterface);
         }
 
-        return true;
+        _moduleTypes.Clear();
     }
 
     [MethodImpl(MethodImplOptions.NoInlining)]
@@ -89,5 +108,6 @@ public class Plugin
         }
 
         ModuleInterfaces.Clear();
+        _moduleTypes.Clear();
     }
 }
@@ -14,6 +14,9 @@ public class PluginLoadContext : AssemblyLoadContext
 
     private readonly AssemblyDependencyResolver _resolver;
     private static readonly Dictionary<string, WeakReference<Assembly>> LoadedAssemblies = new();
+
+    // Load contexts of independent plugins resolve their references concurrently.
+    private static readonly object LoadedAssembliesLock = new();
     
     static PluginLoadContext()
     {
@@ -25,7 +28,10 @@ public class PluginLoadContext : AssemblyLoadContext
     
     private static void AddAssembly(Assembly assembly)
     {
-        LoadedAssemblies[assembly.GetName().Name!] = new WeakReference<Assembly>(assembly);
+        lock (LoadedAssembliesLock)
+        {
+            LoadedAssemblies[assembly.GetName().Name!] = new WeakReference<Assembly>(assembly);
+        }
     }
     
     public static void RemoveAssemblyFromCache(string assemblyName)
@@ -35,7 +41,10 @@ public class PluginLoadContext : AssemblyLoadContext
             return;
         }
         
-        LoadedAssemblies.Remove(assemblyName);
+        lock (LoadedAssembliesLock)
+        {
+            LoadedAssemblies.Remove(assemblyName);
+        }
     }
 
     protected override Assembly? Load(AssemblyName assemblyName)
@@ -45,34 +54,38 @@ public class PluginLoadContext : AssemblyLoadContext
             return null;
         }
         
-        if (LoadedAssemblies.TryGetValue(assemblyName.Name, out WeakReference<Assembly>? weakRef) && weakRef.TryGetTarget(out Assembly? cachedAssembly))
+        // Held across resolving and loading, so plugins loaded in parallel that share a reference all get the same copy.
+        lock (LoadedAssembliesLock)
         {
-            return cachedAssembly;
-        }
+            if (LoadedAssemblies.TryGetValue(assemblyName.Name, out WeakReference<Assembly>? weakRef) && weakRef.TryGetTarget(out Assembly? cachedAssembly))
+            {
+                return cachedAssembly;
+            }
 
-        string? assemblyPath = _resolver.ResolveAssemblyToPath(assemblyName);
+            string? assemblyPath = _resolver.ResolveAssemblyToPath(assemblyName);
 
-        if (string.IsNullOrEmpty(assemblyPath))
-        {
-            return null;
-        }
+            if (string.IsNullOrEmpty(assemblyPath))
+            {
+                return null;
+            }
 
-        using FileStream assemblyFile = File.Open(assemblyPath, FileMode.Open, FileAccess.Read, FileShare.Read);
-        string pdbPath = Path.ChangeExtension(assemblyPath, ".pdb");
+            using FileStream assemblyFile = File.Open(assemblyPath, FileMode.Open, FileAccess.Read, FileShare.Read);
+            string pdbPath = Path.ChangeExtension(assemblyPath, ".pdb");
 
-        Assembly? loadedAssembly;
-        if (!File.Exists(pdbPath))
-        {
-            loadedAssembly = LoadFromStream(assemblyFile);
+            Assembly? loadedAssembly;
+            if (!File.Exists(pdbPath))
+            {
+                loadedAssembly = LoadFromStream(assemblyFile);
+            }
+            else
+            {
+                using var pdbFile = File.Open(pdbPath, FileMode.Open, FileAccess.Read, FileShare.Read);
+                loadedAssembly = LoadFromStream(assemblyFile, pdbFile);
+            }
+            
+            LoadedAssemblies[assemblyName.Name] = new WeakReference<Assembly>(loadedAssembly);
+            return loadedAssembly;
         }
-        else
-        {
-            using var pdbFile = File.Open(pdbPath, FileMode.Open, FileAccess.Read, FileShare.Read);
-            loadedAssembly = LoadFromStream(assemblyFile, pdbFile);
-        }
-        
-        LoadedAssemblies[assemblyName.Name] = new WeakReference<Assembly>(loadedAssembly);
-        return loadedAssembly;
     }
 
     protected override nint LoadUnmanagedDll(string unmanagedDllName)
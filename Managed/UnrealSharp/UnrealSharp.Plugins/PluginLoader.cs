@@ -8,37 +8,47 @@ public static class PluginLoader
 {
     public static readonly List<Plugin> LoadedPlugins = [];
 
-    public static Assembly? LoadPlugin(string assemblyPath, bool isCollectible)
+    // Independent plugins are loaded from worker threads at startup.
+    private static readonly object LoadedPluginsLock = new();
+
+    public static Assembly? LoadPlugin(string assemblyPath, bool isCollectible, bool startModules = true)
     {
         try
         {
             AssemblyName assemblyName = new AssemblyName(Path.GetFileNameWithoutExtension(assemblyPath));
 
-            foreach (Plugin loadedPlugin in LoadedPlugins)
+            lock (LoadedPluginsLock)
             {
-                if (!loadedPlugin.IsLoadContextAlive)
-                {
-                    continue;
-                }
-                
-                if (loadedPlugin.WeakRefAssembly?.Target is not Assembly assembly)
+                foreach (Plugin loadedPlugin in LoadedPlugins)
                 {
-                    continue;
-                }
+                    if (!loadedPlugin.IsLoadContextAlive)
+                    {
+                        continue;
+                    }
+                    
+                    if (loadedPlugin.WeakRefAssembly?.Target is not Assembly assembly)
+                    {
+                        continue;
+                    }
 
-                if (assembly.GetName() != assemblyName)
-                {
-                    continue;
-                }
+                    if (assembly.GetName() != assemblyName)
+                    {
+                        continue;
+                    }
 
-                LogUnrealSharpPlugins.Log($"Plugin {assemblyName} is already loaded.");
-                return assembly;
+                    LogUnrealSharpPlugins.Log($"Plugin {assemblyName} is already loaded.");
+                    return assembly;
+                }
             }
             
             Plugin plugin = new Plugin(assemblyName, isCollectible, assemblyPath);
-            if (plugin.Load() && plugin.WeakRefAssembly != null && plugin.WeakRefAssembly.Target is Assembly loadedAssembly)
+            if (plugin.Load(startModules) && plugin.WeakRefAssembly != null && plugin.WeakRefAssembly.Target is Assembly loadedAssembly)
             {
-                LoadedPlugins.Add(plugin);
+                lock (LoadedPluginsLock)
+                {
+                    LoadedPlugins.Add(plugin);
+                }
+                
                 LogUnrealSharpPlugins.Log($"Successfully loaded plugin: {assemblyName}");
                 return loadedAssembly;
             }
@@ -52,21 +62,45 @@ public static class PluginLoader
 
         return null;
     }
+
+    public static bool StartPluginModules(string assemblyPath)
+    {
+        Plugin? plugin = FindPluginByName(Path.GetFileNameWithoutExtension(assemblyPath));
+        if (plugin == null)
+        {
+            LogUnrealSharpPlugins.LogError($"Can't start the modules of {assemblyPath}, the plugin is not loaded.");
+            return false;
+        }
+
+        try
+        {
+            plugin.StartModules();
+            return true;
+        }
+        catch (Exception ex)
+        {
+            LogUnrealSharpPlugins.LogError($"An error occurred while starting the modules of {plugin.AssemblyName}: {ex.Message}");
+            return false;
+        }
+    }
     
     [MethodImpl(MethodImplOptions.NoInlining)]
     private static WeakReference? RemovePlugin(string assemblyName)
     {
-        foreach (Plugin loadedPlugin in LoadedPlugins)
+        lock (LoadedPluginsLock)
         {
-            // Trying to resolve the weakptr to the assembly here will cause unload issues, so we compare names instead
-            if (!loadedPlugin.IsLoadContextAlive || loadedPlugin.AssemblyName.Name != assemblyName)
+            foreach (Plugin loadedPlugin in LoadedPlugins)
             {
-                continue;
+                // Trying to resolve the weakptr to the assembly here will cause unload issues, so we compare names instead
+                if (!loadedPlugin.IsLoadContextAlive || loadedPlugin.AssemblyName.Name != assemblyName)
+                {
+                    continue;
+                }
+                
+                loadedPlugin.Unload();
+                LoadedPlugins.Remove(loadedPlugin);
+                return loadedPlugin.WeakRefLoadContext;
             }
-            
-            loadedPlugin.Unload();
-            LoadedPlugins.Remove(loadedPlugin);
-            return loadedPlugin.WeakRefLoadContext;
         }
         
         return null;
@@ -125,11 +159,14 @@ public static class PluginLoader
     
     public static Plugin? FindPluginByName(string assemblyName)
     {
-        foreach (Plugin loadedPlugin in LoadedPlugins)
+        lock (LoadedPluginsLock)
         {
-            if (loadedPlugin.AssemblyName.Name == assemblyName)
+            foreach (Plugin loadedPlugin in LoadedPlugins)
             {
-                return loadedPlugin;
+                if (loadedPlugin.AssemblyName.Name == assemblyName)
+                {
+                    return loadedPlugin;
+                }
             }
         }
 
@@ -7,13 +7,14 @@ namespace UnrealSharp.Plugins;
 [StructLayout(LayoutKind.Sequential)]
 public unsafe struct PluginsCallbacks
 {
-    public delegate* unmanaged<char*, NativeBool, nint> LoadPlugin;
+    public delegate* unmanaged<char*, NativeBool, NativeBool, nint> LoadPlugin;
     public delegate* unmanaged<char*, NativeBool> UnloadPlugin;
+    public delegate* unmanaged<char*, NativeBool> StartPluginModules;
     
     [UnmanagedCallersOnly]
-    private static nint ManagedLoadPlugin(char* assemblyPath, NativeBool isCollectible)
+    private static nint ManagedLoadPlugin(char* assemblyPath, NativeBool isCollectible, NativeBool startModules)
     {
-        Assembly? newPlugin = PluginLoader.LoadPlugin(new string(assemblyPath), isCollectible.ToManagedBool());
+        Assembly? newPlugin = PluginLoader.LoadPlugin(new string(assemblyPath), isCollectible.ToManagedBool(), startModules.ToManagedBool());
 
         if (newPlugin == null)
         {
@@ -30,12 +31,19 @@ public unsafe struct PluginsCallbacks
         return PluginLoader.UnloadPlugin(assemblyPathStr).ToNativeBool();
     }
 
+    [UnmanagedCallersOnly]
+    private static NativeBool ManagedStartPluginModules(char* assemblyPath)
+    {
+        return PluginLoader.StartPluginModules(new string(assemblyPath)).ToNativeBool();
+    }
+
     public static PluginsCallbacks Create()
     {
         return new PluginsCallbacks
         {
             LoadPlugin = &ManagedLoadPlugin,
             UnloadPlugin = &ManagedUnloadPlugin,
+            StartPluginModules = &ManagedStartPluginModules,
         };
     }
 }
\ No newline at end of file
@@ -130,9 +130,25 @@ public class NativeCallbacksWrapperGenerator : IIncrementalGenerator
 
                 sourceBuilder.AppendLine(";");
             }
+        }
+
+        // Resolve all bound functions of this class in a single native call.
+        int numDelegates = classInfo.Delegates.Count;
+        if (numDelegates > 0)
+        {
+            string functionNames = string.Join("\\0", classInfo.Delegates.Select(d => d.Name));
+            string functionSizes = string.Join(", ", classInfo.Delegates.Select(d => d.Name + "TotalSize"));
+            
+            sourceBuilder.AppendLine($"             int* __functionSizes = stackalloc int[] {{ {functionSizes} }};");
+            sourceBuilder.AppendLine($"             IntPtr* __functionPtrs = stackalloc IntPtr[{numDelegates}];");
+            sourceBuilder.AppendLine($"             UnrealSharp.Binds.NativeBinds.TryGetBoundFunctions(\"{classInfo.Name}\", \"{functionNames}\", __functionSizes, __functionPtrs, {numDelegates});");
+        }
 
-            string funcPtrName = delegateName + "FuncPtr";
-            sourceBuilder.AppendLine($"             IntPtr {funcPtrName} = UnrealSharp.Binds.NativeBinds.TryGetBoundFunction(\"{classInfo.Name}\", \"{delegateInfo.Name}\", {totalSizeDelegateName});");
+        for (int delegateIndex = 0; delegateIndex < numDelegates; delegateIndex++)
+        {
+            DelegateInfo delegateInfo = classInfo.Delegates[delegateIndex];
+            string delegateName = delegateInfo.Name;
+            
             sourceBuilder.Append($"             {delegateName} = (delegate* unmanaged<");
             sourceBuilder.Append(string.Join(", ", delegateInfo.Parameters.Select(p =>
             {
@@ -147,7 +163,7 @@ public class NativeCallbacksWrapperGenerator : IIncrementalGenerator
 
             sourceBuilder.Append(delegateInfo.ReturnValue.Type.GetAnnotatedTypeName(model) ?? delegateInfo.ReturnValue.Type.ToString());
 
-            sourceBuilder.Append($">){funcPtrName};");
+            sourceBuilder.Append($">)__functionPtrs[{delegateIndex}];");
             sourceBuilder.AppendLine();
         }
 
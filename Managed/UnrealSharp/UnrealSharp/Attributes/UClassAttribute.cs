@@ -123,4 +123,14 @@ public sealed class UClassAttribute(ClassFlags flags = ClassFlags.None) : BaseUA
     /// The category of the config file to use for this class.
     /// </summary>
     public string ConfigCategory;
+
+    /// <summary>
+    /// Max number of C# objects of this class kept alive for reuse after their UObjects are destroyed.
+    /// Useful for classes that are spawned and destroyed at a high rate, like projectiles.
+    /// The default constructor runs again when a pooled object is reused, so all state should be reset there.
+    /// Anything the constructor doesn't reset carries over to the new UObject, including C# event subscribers and caches keyed on the object.
+    /// Don't hold references to objects of pooled classes after they're destroyed: once the C# object is reused, such a reference points to the new UObject.
+    /// Hold a TWeakObjectPtr instead, or store the object's Generation with the reference and check it with IsValidGeneration.
+    /// </summary>
+    public int ManagedObjectPoolSize;
 }
\ No newline at end of file
@@ -0,0 +1,108 @@
+using System.Collections.Concurrent;
+using System.Reflection;
+using System.Runtime.CompilerServices;
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Owns a native binding of a target object and one of its UFunctions, resolved once and reused
+/// for every add, remove and contains call on multicast delegates.
+/// </summary>
+internal sealed class DelegateBinding
+{
+    public readonly IntPtr Handle;
+
+    public DelegateBinding(IntPtr nativeObject, string functionName)
+    {
+        Handle = FMulticastDelegatePropertyExporter.CallCreateBinding(nativeObject, functionName);
+    }
+
+    public void Release()
+    {
+        FMulticastDelegatePropertyExporter.CallReleaseBinding(Handle);
+        GC.SuppressFinalize(this);
+    }
+
+    ~DelegateBinding()
+    {
+        // Only reached if the target was never disposed. Native code can't be called from the finalizer thread, so the release is deferred.
+        DelegateBindingCache.DeferRelease(Handle);
+    }
+}
+
+internal static class DelegateBindingCache
+{
+    // The bindings of one target, only valid for the UObject they were created for.
+    private sealed class TargetBindings
+    {
+        public TargetBindings(IntPtr nativeObject)
+        {
+            NativeObject = nativeObject;
+        }
+
+        public readonly IntPtr NativeObject;
+        public readonly ConcurrentDictionary<MethodInfo, DelegateBinding> Bindings = new();
+
+        public void Release()
+        {
+            foreach (DelegateBinding binding in Bindings.Values)
+            {
+                binding.Release();
+            }
+            
+            Bindings.Clear();
+        }
+    }
+
+    // Bindings are released when the managed wrapper of their target object is disposed.
+    private static readonly ConditionalWeakTable<UObject, TargetBindings> Bindings = new();
+    
+    private static readonly ConcurrentQueue<IntPtr> PendingReleases = new();
+
+    public static IntPtr GetOrCreate(UObject target, MethodInfo method)
+    {
+        ReleasePending();
+        
+        IntPtr nativeObject = target.NativeObject;
+
+        // A wrapper isn't tied to one UObject for its whole life, pooled wrappers are bound to a new UObject when they're reused.
+        if (!Bindings.TryGetValue(target, out TargetBindings? targetBindings) || targetBindings.NativeObject != nativeObject)
+        {
+            targetBindings?.Release();
+            targetBindings = new TargetBindings(nativeObject);
+            Bindings.AddOrUpdate(target, targetBindings);
+        }
+
+        // Multicast delegates are only modified on the game thread, so the factory doesn't race and leak a binding.
+        DelegateBinding binding = targetBindings.Bindings.GetOrAdd(method, static (key, owner) => new DelegateBinding(owner, key.Name), nativeObject);
+        return binding.Handle;
+    }
+
+    public static void Remove(UObject target)
+    {
+        ReleasePending();
+        
+        if (!Bindings.TryGetValue(target, out TargetBindings? targetBindings))
+        {
+            return;
+        }
+        
+        Bindings.Remove(target);
+        targetBindings.Release();
+    }
+
+    internal static void DeferRelease(IntPtr handle)
+    {
+        PendingReleases.Enqueue(handle);
+    }
+
+    private static void ReleasePending()
+    {
+        while (PendingReleases.TryDequeue(out IntPtr handle))
+        {
+            FMulticastDelegatePropertyExporter.CallReleaseBinding(handle);
+        }
+    }
+}
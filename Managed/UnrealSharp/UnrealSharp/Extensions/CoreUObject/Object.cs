@@ -38,6 +38,13 @@ public partial class UObject
     /// </summary>
     public bool IsDestroyed => NativeObject == IntPtr.Zero || !UObjectExporter.CallNativeIsValid(NativeObject).ToManagedBool();
 
+    /// <summary>
+    /// Whether the object is valid and still represents the same UObject as when the generation was stored.
+    /// Objects of pooled classes are reused for new UObjects, which <see cref="IsValid"/> alone can't tell apart.
+    /// </summary>
+    /// <param name="generation"> The <see cref="UnrealSharpObject.Generation"/> stored along with the reference. </param>
+    public bool IsValidGeneration(uint generation) => Generation == generation && IsValid;
+
     /// <summary>
     /// The unique ID of the object... These are reused so it is only unique while the object is alive.
     /// </summary>
@@ -95,6 +102,14 @@ public partial class UObject
         return NativeObject.GetHashCode();
     }
 
+    /// <inheritdoc />
+    public override void Dispose()
+    {
+        // Pooled objects are disposed before they're bound to a new UObject, the delegate bindings of the old one must not carry over.
+        DelegateBindingCache.Remove(this);
+        base.Dispose();
+    }
+
     public static implicit operator bool(UObject Object)
     {
         return Object != null && UObjectExporter.CallNativeIsValid(Object.NativeObject).ToManagedBool();
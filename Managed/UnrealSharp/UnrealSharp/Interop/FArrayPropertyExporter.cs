@@ -13,4 +13,5 @@ public static unsafe partial class FArrayPropertyExporter
     public static delegate* unmanaged<IntPtr, UnmanagedArray*, int, void> RemoveFromArray;
     public static delegate* unmanaged<IntPtr, UnmanagedArray*, int, void> ResizeArray;
     public static delegate* unmanaged<IntPtr, UnmanagedArray*, int, int, void> SwapValues;
+    public static delegate* unmanaged<IntPtr, int, NativeBool> IsBulkCopyCompatible;
 }
\ No newline at end of file
@@ -14,4 +14,11 @@ public static unsafe partial class FMulticastDelegatePropertyExporter
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> BroadcastDelegate;
     public static delegate* unmanaged<IntPtr, IntPtr> GetSignatureFunction;
     public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, string, NativeBool> ContainsDelegate; 
+    public static delegate* unmanaged<IntPtr, string, IntPtr> CreateBinding;
+    public static delegate* unmanaged<IntPtr, void> ReleaseBinding;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> AddBinding;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, void> RemoveBinding;
+    public static delegate* unmanaged<IntPtr, IntPtr, IntPtr, NativeBool> ContainsBinding;
+    public static delegate* unmanaged<IntPtr, NativeBool> IsSparseDelegate;
+    public static delegate* unmanaged<IntPtr, IntPtr, void> BroadcastInlineDelegate;
 }
\ No newline at end of file
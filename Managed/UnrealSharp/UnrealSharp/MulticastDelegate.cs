@@ -11,12 +11,18 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
 {
     protected IntPtr NativeProperty;
     protected IntPtr NativeDelegate;
+    private bool? _isSparseDelegate;
 
     public override void FromNative(IntPtr address, IntPtr nativeProperty)
     {
         // Keep a reference to the property and delegate for later usage
         NativeDelegate = address;
-        NativeProperty = nativeProperty;
+        
+        if (NativeProperty != nativeProperty)
+        {
+            NativeProperty = nativeProperty;
+            _isSparseDelegate = null;
+        }
     }
 
     public override void ToNative(IntPtr address)
@@ -27,7 +33,17 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
 
     protected override void ProcessDelegate(IntPtr parameters)
     {
-        FMulticastDelegatePropertyExporter.CallBroadcastDelegate(NativeProperty, NativeDelegate, parameters);
+        // The kind of the property never changes, so only sparse delegates pay for the lookup through their owner.
+        _isSparseDelegate ??= FMulticastDelegatePropertyExporter.CallIsSparseDelegate(NativeProperty).ToManagedBool();
+        
+        if (_isSparseDelegate.Value)
+        {
+            FMulticastDelegatePropertyExporter.CallBroadcastDelegate(NativeProperty, NativeDelegate, parameters);
+        }
+        else
+        {
+            FMulticastDelegatePropertyExporter.CallBroadcastInlineDelegate(NativeDelegate, parameters);
+        }
     }
 
     public override void BindUFunction(UObject targetObject, FName functionName)
@@ -46,7 +62,8 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             throw new ArgumentException("The callback for a multicast delegate must be a valid UFunction defined on a UClass", nameof(handler));
         }
-        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name);
+        IntPtr binding = DelegateBindingCache.GetOrCreate(targetObject, handler.Method);
+        FMulticastDelegatePropertyExporter.CallAddBinding(NativeProperty, NativeDelegate, binding);
     }
 
     public override void Remove(TDelegate handler)
@@ -55,7 +72,8 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             return;
         }
-        FMulticastDelegatePropertyExporter.CallRemoveDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name);
+        IntPtr binding = DelegateBindingCache.GetOrCreate(targetObject, handler.Method);
+        FMulticastDelegatePropertyExporter.CallRemoveBinding(NativeProperty, NativeDelegate, binding);
     }
 
     public override bool Contains(TDelegate handler)
@@ -64,7 +82,8 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             return false;
         }
-        return FMulticastDelegatePropertyExporter.CallContainsDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name).ToManagedBool();
+        IntPtr binding = DelegateBindingCache.GetOrCreate(targetObject, handler.Method);
+        return FMulticastDelegatePropertyExporter.CallContainsBinding(NativeProperty, NativeDelegate, binding).ToManagedBool();
     }
 
     public override bool IsBound => FMulticastDelegatePropertyExporter.CallIsBound(NativeDelegate).ToManagedBool();
@@ -22,24 +22,12 @@ public struct FName : IEquatable<FName>, IComparable<FName>
     
     public FName(string name)
     {
-        unsafe
-        {
-            fixed (char* stringPtr = name)
-            {
-                FNameExporter.CallStringToName(ref this, stringPtr, name.Length);
-            }
-        }
+        this = FNameCache.FindOrAddName(name);
     }
     
     public FName(ReadOnlySpan<char> name)
     {
-        unsafe
-        {
-            fixed (char* stringPtr = name)
-            {
-                FNameExporter.CallStringToName(ref this, stringPtr, name.Length);
-            }
-        }
+        this = FNameCache.FindOrAddName(name);
     }
 
     private FName(uint comparisonIndex, uint number)
@@ -48,8 +36,35 @@ public struct FName : IEquatable<FName>, IComparable<FName>
         Number = number;
     }
 
+    // Names are never removed from the native name table, so the string of a display entry and number never changes.
+#if !WITH_EDITOR
+    internal ulong CacheKey => (ulong) ComparisonIndex << 32 | Number;
+#else
+    internal ulong CacheKey => (ulong) DisplayIndex << 32 | Number;
+#endif
+
     /// <inheritdoc />
     public override string ToString()
+    {
+        return FNameCache.FindOrAddString(this);
+    }
+
+    internal static FName FromStringUncached(ReadOnlySpan<char> name)
+    {
+        FName result = default;
+        
+        unsafe
+        {
+            fixed (char* stringPtr = name)
+            {
+                FNameExporter.CallStringToName(ref result, stringPtr, name.Length);
+            }
+        }
+        
+        return result;
+    }
+
+    internal string ToStringUncached()
     {
         unsafe
         {
@@ -95,6 +110,12 @@ public struct FName : IEquatable<FName>, IComparable<FName>
     
     public static implicit operator string(FName name)
     {
+        // FNameCache only caches valid names, so a hit doesn't need the validity check.
+        if (FNameCache.TryFindString(name, out string? cachedString))
+        {
+            return cachedString;
+        }
+        
         return name.IsValid ? name.ToString() : None.ToString();
     }
     
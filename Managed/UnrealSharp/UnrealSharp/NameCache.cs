@@ -0,0 +1,169 @@
+﻿using System.Collections.Concurrent;
+using System.Diagnostics.CodeAnalysis;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Caches FName and string conversions, so names that are used repeatedly don't cross into native code and allocate a new string every time.
+/// Both directions are bounded and start over once they reach their maximum size.
+/// </summary>
+public static class FNameCache
+{
+    /// <summary>
+    /// The maximum number of entries in each direction before the cache is cleared.
+    /// </summary>
+    public const int MaxEntries = 64 * 1024;
+    
+    private static readonly ConcurrentDictionary<ulong, string> Strings = new();
+    private static readonly ConcurrentDictionary<string, FName> Names = new(StringComparer.Ordinal);
+    private static readonly ConcurrentDictionary<string, FName>.AlternateLookup<ReadOnlySpan<char>> NamesBySpan = Names.GetAlternateLookup<ReadOnlySpan<char>>();
+    
+    private static int _numStrings;
+    private static int _numNames;
+    
+    private static long _stringHits;
+    private static long _stringMisses;
+    private static long _nameHits;
+    private static long _nameMisses;
+
+    /// <summary>
+    /// Number of FName to string conversions that were served from the cache.
+    /// </summary>
+    public static long StringHits => Interlocked.Read(ref _stringHits);
+    
+    /// <summary>
+    /// Number of FName to string conversions that had to call into native code.
+    /// </summary>
+    public static long StringMisses => Interlocked.Read(ref _stringMisses);
+    
+    /// <summary>
+    /// Number of string to FName conversions that were served from the cache.
+    /// </summary>
+    public static long NameHits => Interlocked.Read(ref _nameHits);
+    
+    /// <summary>
+    /// Number of string to FName conversions that had to call into native code.
+    /// </summary>
+    public static long NameMisses => Interlocked.Read(ref _nameMisses);
+    
+    /// <summary>
+    /// Number of cached FName to string conversions.
+    /// </summary>
+    public static int NumStrings => Volatile.Read(ref _numStrings);
+    
+    /// <summary>
+    /// Number of cached string to FName conversions.
+    /// </summary>
+    public static int NumNames => Volatile.Read(ref _numNames);
+    
+    /// <summary>
+    /// Fraction of all conversions, in both directions, that were served from the cache.
+    /// </summary>
+    public static double HitRate
+    {
+        get
+        {
+            long hits = StringHits + NameHits;
+            long total = hits + StringMisses + NameMisses;
+            return total == 0 ? 0.0 : (double) hits / total;
+        }
+    }
+
+    internal static bool TryFindString(FName name, [NotNullWhen(true)] out string? nameString)
+    {
+        if (!Strings.TryGetValue(name.CacheKey, out nameString))
+        {
+            return false;
+        }
+        
+        Interlocked.Increment(ref _stringHits);
+        return true;
+    }
+
+    internal static string FindOrAddString(FName name)
+    {
+        ulong key = name.CacheKey;
+        
+        if (Strings.TryGetValue(key, out string? cachedString))
+        {
+            Interlocked.Increment(ref _stringHits);
+            return cachedString;
+        }
+        
+        Interlocked.Increment(ref _stringMisses);
+        string nameString = name.ToStringUncached();
+        
+        // Only valid names are cached, so a hit also tells the implicit string conversion that the name is valid.
+        if (name.IsValid && Strings.TryAdd(key, nameString))
+        {
+            TrimIfFull(Strings, ref _numStrings);
+        }
+        
+        return nameString;
+    }
+
+    internal static FName FindOrAddName(string nameString)
+    {
+        if (Names.TryGetValue(nameString, out FName cachedName))
+        {
+            Interlocked.Increment(ref _nameHits);
+            return cachedName;
+        }
+        
+        Interlocked.Increment(ref _nameMisses);
+        FName name = FName.FromStringUncached(nameString);
+        
+        if (Names.TryAdd(nameString, name))
+        {
+            TrimIfFull(Names, ref _numNames);
+        }
+        
+        return name;
+    }
+    
+    internal static FName FindOrAddName(ReadOnlySpan<char> nameString)
+    {
+        if (NamesBySpan.TryGetValue(nameString, out FName cachedName))
+        {
+            Interlocked.Increment(ref _nameHits);
+            return cachedName;
+        }
+        
+        Interlocked.Increment(ref _nameMisses);
+        FName name = FName.FromStringUncached(nameString);
+        
+        if (NamesBySpan.TryAdd(nameString, name))
+        {
+            TrimIfFull(Names, ref _numNames);
+        }
+        
+        return name;
+    }
+
+    /// <summary>
+    /// Clears both directions of the cache and resets the stats.
+    /// </summary>
+    public static void Clear()
+    {
+        Strings.Clear();
+        Names.Clear();
+        Interlocked.Exchange(ref _numStrings, 0);
+        Interlocked.Exchange(ref _numNames, 0);
+        Interlocked.Exchange(ref _stringHits, 0);
+        Interlocked.Exchange(ref _stringMisses, 0);
+        Interlocked.Exchange(ref _nameHits, 0);
+        Interlocked.Exchange(ref _nameMisses, 0);
+    }
+
+    private static void TrimIfFull<TKey, TValue>(ConcurrentDictionary<TKey, TValue> cache, ref int count) where TKey : notnull
+    {
+        if (Interlocked.Increment(ref count) <= MaxEntries)
+        {
+            return;
+        }
+        
+        // Counting the dictionary takes all of its locks, so the size is tracked separately and is only approximate under contention.
+        Interlocked.Exchange(ref count, 0);
+        cache.Clear();
+    }
+}
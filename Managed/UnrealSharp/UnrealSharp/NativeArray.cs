@@ -1,5 +1,4 @@
-﻿using System.Numerics;
-using System.Runtime.CompilerServices;
+﻿using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using UnrealSharp.Attributes;
 using UnrealSharp.Core;
@@ -10,10 +9,11 @@ namespace UnrealSharp;
 
 /// <summary>
 /// An blittable type only array that can be used to interact with Unreal Engine arrays in a optimized manner.
+/// Also used as the raw memory view of <see cref="TArray{T}"/>, see <see cref="UnrealArrayExtensions"/>.
 /// </summary>
 /// <typeparam name="T"> The type of elements in the array. </typeparam>
 [Binding]
-public unsafe class TNativeArray<T> : IEnumerable<T> where T : INumber<T>
+public unsafe class TNativeArray<T> : IEnumerable<T> where T : unmanaged
 {
     protected readonly IntPtr NativeUnrealProperty;
     protected UnmanagedArray* NativeBuffer { get; }
@@ -108,6 +108,19 @@ public unsafe class TNativeArray<T> : IEnumerable<T> where T : INumber<T>
         span.CopyTo(destination);
     }
 
+    /// <summary>
+    /// Append the elements of a span to the array
+    /// </summary>
+    /// <param name="span"> The elements to append. </param>
+    public void Append(ReadOnlySpan<T> span)
+    {
+        int startIndex = Length;
+        FArrayPropertyExporter.CallResizeArray(NativeUnrealProperty, NativeBuffer, startIndex + span.Length);
+
+        Span<T> destination = new Span<T>(NativeArrayBuffer.ToPointer(), Length).Slice(startIndex);
+        span.CopyTo(destination);
+    }
+
     /// <summary>
     /// Gets the NativeArrayBuffer as a span
     /// </summary>
@@ -150,7 +163,7 @@ public unsafe class TNativeArray<T> : IEnumerable<T> where T : INumber<T>
 }
 
 public class UnrealNativeArrayEnumerator<T>(TNativeArray<T> array) : IEnumerator<T>
-    where T : INumber<T>
+    where T : unmanaged
 {
     private int _index = -1;
     public T Current => array[_index];
@@ -175,7 +188,7 @@ public class UnrealNativeArrayEnumerator<T>(TNativeArray<T> array) : IEnumerator
 }
 
 public class NativeArrayMarshaller<T>(IntPtr nativeProperty) 
-    where T : INumber<T>
+    where T : unmanaged
 {
     private TNativeArray<T>? _nativeArrayWrapper;
 
@@ -1,5 +1,6 @@
 ﻿using System.Runtime.InteropServices;
 using UnrealSharp.Core;
+using UnrealSharp.Core.Attributes;
 using UnrealSharp.Core.Marshallers;
 using UnrealSharp.Interop;
 
@@ -89,6 +90,33 @@ public abstract unsafe class UnrealArrayBase<T> : IEnumerable<T>
         FArrayPropertyExporter.CallRemoveFromArray(NativeProperty, NativeBuffer, index);
     }
 
+    /// <summary>
+    /// Gets a <see cref="TNativeArray{T}"/> over the same native array, for working on the elements as raw memory.
+    /// </summary>
+    /// <exception cref="InvalidOperationException"> Thrown if the native elements can't be viewed as <typeparamref name="TElement"/>. </exception>
+    internal TNativeArray<TElement> AsNativeArrayInternal<TElement>() where TElement : unmanaged
+    {
+        if (_nativeArray is TNativeArray<TElement> nativeArray)
+        {
+            return nativeArray;
+        }
+        
+        // Only primitives and structs the glue or the weaver marked as blittable are guaranteed to have the native layout.
+        Type elementType = typeof(TElement);
+        bool isBlittable = elementType.IsPrimitive || elementType.IsEnum || elementType.IsDefined(typeof(BlittableTypeAttribute), false);
+        
+        if (!isBlittable || !FArrayPropertyExporter.CallIsBulkCopyCompatible(NativeProperty, sizeof(TElement)).ToManagedBool())
+        {
+            throw new InvalidOperationException($"Array of {elementType.Name} is not a primitive or blittable struct array with a matching element size, and can't be accessed as raw memory.");
+        }
+        
+        nativeArray = new TNativeArray<TElement>(NativeProperty, (IntPtr) NativeBuffer);
+        _nativeArray = nativeArray;
+        return nativeArray;
+    }
+
+    private object? _nativeArray;
+
     /// <summary>
     /// Gets the element at the specified index.
     /// </summary>
@@ -137,6 +165,64 @@ public abstract unsafe class UnrealArrayBase<T> : IEnumerable<T>
     }
 }
 
+public static class UnrealArrayExtensions
+{
+    /// <summary>
+    /// Gets a <see cref="TNativeArray{T}"/> over the array, for working on the elements as raw memory without marshalling each element.
+    /// Only valid for primitive, enum and blittable struct elements (e.g. float, int, FVector).
+    /// </summary>
+    /// <param name="array"> The array to view. </param>
+    /// <returns> A native array over the same elements. </returns>
+    public static TNativeArray<T> AsNativeArray<T>(this TArray<T> array) where T : unmanaged
+    {
+        return array.AsNativeArrayInternal<T>();
+    }
+
+    /// <summary>
+    /// Gets a span over the native array buffer, for reading and writing elements in place without marshalling each element.
+    /// Only valid for primitive, enum and blittable struct elements, and only until the array is resized.
+    /// </summary>
+    /// <param name="array"> The array to view. </param>
+    /// <returns> A span over the elements of the array. </returns>
+    public static Span<T> AsSpan<T>(this TArray<T> array) where T : unmanaged
+    {
+        return array.AsNativeArrayInternal<T>().AsSpan();
+    }
+
+    /// <summary>
+    /// Gets a read-only span over the native array buffer, for reading elements without marshalling each element.
+    /// Only valid for primitive, enum and blittable struct elements, and only until the array is resized.
+    /// </summary>
+    /// <param name="array"> The array to view. </param>
+    /// <returns> A read-only span over the elements of the array. </returns>
+    public static ReadOnlySpan<T> AsReadOnlySpan<T>(this UnrealArrayBase<T> array) where T : unmanaged
+    {
+        return array.AsNativeArrayInternal<T>().AsReadOnlySpan();
+    }
+
+    /// <summary>
+    /// Replaces the contents of the array with the given elements, with a single resize and copy.
+    /// Only valid for primitive, enum and blittable struct elements.
+    /// </summary>
+    /// <param name="array"> The array to set. </param>
+    /// <param name="elements"> The new elements of the array. </param>
+    public static void SetFromSpan<T>(this TArray<T> array, ReadOnlySpan<T> elements) where T : unmanaged
+    {
+        array.AsNativeArrayInternal<T>().CopyFrom(elements);
+    }
+
+    /// <summary>
+    /// Appends the given elements to the array, with a single resize and copy.
+    /// Only valid for primitive, enum and blittable struct elements.
+    /// </summary>
+    /// <param name="array"> The array to append to. </param>
+    /// <param name="elements"> The elements to append. </param>
+    public static void AddRange<T>(this TArray<T> array, ReadOnlySpan<T> elements) where T : unmanaged
+    {
+        array.AsNativeArrayInternal<T>().Append(elements);
+    }
+}
+
 public class ArrayCopyMarshaller<T>
 {
     private readonly IntPtr _nativeProperty;
@@ -0,0 +1,162 @@
+using System.Diagnostics;
+using System.Reflection;
+using System.Reflection.Emit;
+using System.Runtime.InteropServices;
+using UnrealSharp.Core;
+using UnrealSharp.Core.Attributes;
+
+namespace UnrealSharpBenchmarks;
+
+/// <summary>
+/// Measures how long resolving the type handles of an assembly takes when it loads, for assemblies with 1k, 5k and 10k generated types.
+/// Compares the bulk LookupManagedTypes callback that UCSAssembly::ResolveTypeHandles uses against the per-type scan LookupManagedType used to do.
+/// Run with: dotnet run -c Release --project Managed/UnrealSharpPrograms/UnrealSharpBenchmarks
+/// </summary>
+public static unsafe class Program
+{
+    private static readonly int[] TypeCounts = [1000, 5000, 10000];
+    private const int Iterations = 5;
+
+    // The per-type scan is quadratic, so it's timed on a sample of the lookups and scaled up to the full count.
+    private const int ScanSamples = 100;
+
+    public static void Main()
+    {
+        Console.WriteLine($"{"Types",8} {"Bulk lookup (ms)",18} {"Per-type scan (ms, est.)",26}");
+
+        foreach (int typeCount in TypeCounts)
+        {
+            double bulkLookup = Median(() => MeasureBulkLookup(typeCount));
+            double perTypeScan = Median(() => MeasurePerTypeScan(typeCount));
+            Console.WriteLine($"{typeCount,8} {bulkLookup,18:F2} {perTypeScan,26:F2}");
+        }
+    }
+
+    private static double MeasureBulkLookup(int typeCount)
+    {
+        // A new assembly every time, the type index is built once per assembly like it is on a real load.
+        Assembly assembly = CreateGeneratedAssembly(typeCount, out string[] fullTypeNames);
+        GCHandle assemblyHandle = GCHandleUtilities.AllocateStrongPointer(assembly, assembly);
+
+        // The native side passes TCHAR strings, which are UTF-16 like C# chars.
+        IntPtr[] nativeNames = Array.ConvertAll(fullTypeNames, Marshal.StringToHGlobalUni);
+        IntPtr[] typeHandles = new IntPtr[typeCount];
+
+        delegate* unmanaged<IntPtr, char**, int, IntPtr*, void> lookupManagedTypes = &UnmanagedCallbacks.LookupManagedTypes;
+
+        Stopwatch stopwatch = Stopwatch.StartNew();
+
+        fixed (IntPtr* names = nativeNames)
+        fixed (IntPtr* handles = typeHandles)
+        {
+            lookupManagedTypes(GCHandle.ToIntPtr(assemblyHandle), (char**) names, typeCount, handles);
+        }
+
+        stopwatch.Stop();
+
+        foreach (IntPtr typeHandle in typeHandles)
+        {
+            if (typeHandle == IntPtr.Zero)
+            {
+                throw new InvalidOperationException("LookupManagedTypes didn't resolve every generated type.");
+            }
+
+            GCHandleUtilities.Free(GCHandle.FromIntPtr(typeHandle), assembly);
+        }
+
+        foreach (IntPtr nativeName in nativeNames)
+        {
+            Marshal.FreeHGlobal(nativeName);
+        }
+
+        GCHandleUtilities.Free(assemblyHandle, assembly);
+        return stopwatch.Elapsed.TotalMilliseconds;
+    }
+
+    private static double MeasurePerTypeScan(int typeCount)
+    {
+        Assembly assembly = CreateGeneratedAssembly(typeCount, out string[] fullTypeNames);
+        int step = Math.Max(1, typeCount / ScanSamples);
+        int samples = 0;
+
+        Stopwatch stopwatch = Stopwatch.StartNew();
+
+        for (int i = 0; i < typeCount; i += step, samples++)
+        {
+            if (FindTypeByScan(assembly, fullTypeNames[i]) == null)
+            {
+                throw new InvalidOperationException($"The scan didn't find {fullTypeNames[i]}.");
+            }
+        }
+
+        stopwatch.Stop();
+        return stopwatch.Elapsed.TotalMilliseconds / samples * typeCount;
+    }
+
+    // What FindTypeInAssembly did for every type before the assemblies got a type index.
+    private static Type? FindTypeByScan(Assembly assembly, string fullTypeName)
+    {
+        Type[] types = assembly.GetTypes();
+        foreach (Type type in types)
+        {
+            foreach (CustomAttributeData attributeData in type.CustomAttributes)
+            {
+                if (attributeData.AttributeType.FullName != typeof(GeneratedTypeAttribute).FullName)
+                {
+                    continue;
+                }
+
+                if (attributeData.ConstructorArguments.Count != 2)
+                {
+                    continue;
+                }
+
+                string fullName = (string) attributeData.ConstructorArguments[1].Value!;
+                if (fullName == fullTypeName)
+                {
+                    return type;
+                }
+            }
+        }
+
+        return null;
+    }
+
+    // Emits the types the way the source generators tag them, one [GeneratedType] per type.
+    private static Assembly CreateGeneratedAssembly(int typeCount, out string[] fullTypeNames)
+    {
+        AssemblyName assemblyName = new($"BenchmarkTypes{typeCount}_{Guid.NewGuid():N}");
+        AssemblyBuilder assemblyBuilder = AssemblyBuilder.DefineDynamicAssembly(assemblyName, AssemblyBuilderAccess.Run);
+        ModuleBuilder moduleBuilder = assemblyBuilder.DefineDynamicModule(assemblyName.Name!);
+
+        ConstructorInfo attributeConstructor = typeof(GeneratedTypeAttribute).GetConstructor([typeof(string), typeof(string)])!;
+        fullTypeNames = new string[typeCount];
+
+        for (int i = 0; i < typeCount; i++)
+        {
+            string typeName = $"BenchmarkTypes.UBenchmarkType{i}";
+            TypeBuilder typeBuilder = moduleBuilder.DefineType(typeName, TypeAttributes.Public | TypeAttributes.Class);
+            typeBuilder.SetCustomAttribute(new CustomAttributeBuilder(attributeConstructor, [$"BenchmarkType{i}", typeName]));
+            typeBuilder.CreateType();
+
+            fullTypeNames[i] = typeName;
+        }
+
+        return assemblyBuilder;
+    }
+
+    private static double Median(Func<double> measure)
+    {
+        // Warms up the JIT and reflection caches before anything is timed.
+        measure();
+
+        double[] results = new double[Iterations];
+        for (int i = 0; i < Iterations; i++)
+        {
+            results[i] = measure();
+        }
+
+        Array.Sort(results);
+        return results[Iterations / 2];
+    }
+}
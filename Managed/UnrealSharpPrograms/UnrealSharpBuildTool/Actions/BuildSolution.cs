@@ -22,6 +22,13 @@ public class BuildSolution : BuildToolAction
             throw new Exception($"Couldn't find the solution file at \"{_folder}\"");
         }
 
+        // The server keeps MSBuild loaded. Publishing and extra command line arguments still go through the dotnet CLI.
+        if (BuildToolServer.CanBuildInProcess && _buildConfig != BuildConfig.Publish && (_extraArguments == null || _extraArguments.Count == 0)
+            && InProcessBuild.TryFindProjectFile(_folder, out string projectFile))
+        {
+            return InProcessBuild.Build(projectFile, Program.GetBuildConfiguration(_buildConfig));
+        }
+
         using BuildToolProcess buildSolutionProcess = new BuildToolProcess();
 
         if (_buildConfig == BuildConfig.Publish)
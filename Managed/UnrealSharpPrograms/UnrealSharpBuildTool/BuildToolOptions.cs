@@ -15,6 +15,7 @@ public enum BuildAction : int
     PackageProject,
     GenerateSolution,
     BuildWeave,
+    Server,
 }
 
 public enum BuildConfig : int
@@ -26,7 +27,7 @@ public enum BuildConfig : int
 
 public class BuildToolOptions
 {
-    [Option("Action", Required = true, HelpText = "The action the build tool should process. Possible values: Build, Clean, GenerateProject, Rebuild, Weave, PackageProject, GenerateSolution, BuildWeave.")]
+    [Option("Action", Required = true, HelpText = "The action the build tool should process. Possible values: Build, Clean, GenerateProject, Rebuild, Weave, PackageProject, GenerateSolution, BuildWeave, Server.")]
     public BuildAction Action { get; set; }
 
     [Option("DotNetPath", Required = false, HelpText = "The path to the dotnet.exe")]
@@ -38,6 +38,7 @@ public class BuildToolProcess : Process
             if (e.Data != null)
             {
                 output.AppendLine(e.Data);
+                ForwardOutput(e.Data);
             }
         };
             
@@ -46,6 +47,7 @@ public class BuildToolProcess : Process
             if (e.Data != null)
             {
                 output.AppendLine(e.Data);
+                ForwardOutput(e.Data);
             }
         };
             
@@ -71,4 +73,17 @@ public class BuildToolProcess : Process
 
         return true;
     }
+
+    private static void ForwardOutput(string line)
+    {
+        if (!Program.StreamProcessOutput)
+        {
+            return;
+        }
+
+        lock (Console.Out)
+        {
+            Console.WriteLine(line);
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+using Microsoft.Build.Locator;
+using Newtonsoft.Json;
+using UnrealSharpBuildTool.Actions;
+
+namespace UnrealSharpBuildTool;
+
+/// <summary>
+/// Keeps the build tool running and processes actions sent by the editor over standard input, one request per line.
+/// A request is a JSON array with the same arguments as a one-shot invocation. After each request the server prints
+/// <see cref="ResultPrefix"/> followed by the exit code, output of the action is written before that as it happens.
+/// </summary>
+public static class BuildToolServer
+{
+    public const string ResultPrefix = "##UnrealSharpBuildToolResult ";
+    private const string ExitRequest = "exit";
+
+    /// <summary>
+    /// Set once MSBuild is loaded into the server, builds then run through <see cref="InProcessBuild"/> instead of a dotnet build process.
+    /// </summary>
+    public static bool CanBuildInProcess { get; private set; }
+
+    public static int Run()
+    {
+        Program.StreamProcessOutput = true;
+        CanBuildInProcess = TryRegisterMSBuild();
+        Console.WriteLine("UnrealSharpBuildTool server started.");
+        Console.Out.Flush();
+
+        while (Console.In.ReadLine() is { } request)
+        {
+            if (request == ExitRequest)
+            {
+                break;
+            }
+
+            if (string.IsNullOrWhiteSpace(request))
+            {
+                continue;
+            }
+
+            int exitCode = RunRequest(request);
+
+            lock (Console.Out)
+            {
+                Console.WriteLine($"{ResultPrefix}{exitCode}");
+                Console.Out.Flush();
+            }
+        }
+
+        return 0;
+    }
+
+    private static bool TryRegisterMSBuild()
+    {
+        try
+        {
+            MSBuildLocator.RegisterDefaults();
+            return true;
+        }
+        catch (Exception exception)
+        {
+            Console.WriteLine($"Couldn't load MSBuild, builds will run in a separate dotnet process: {exception.Message}");
+            return false;
+        }
+    }
+
+    private static int RunRequest(string request)
+    {
+        try
+        {
+            string[] args = JsonConvert.DeserializeObject<string[]>(request) ?? throw new Exception("Empty request.");
+            Program.BuildToolOptions = Program.ParseOptions(args);
+
+            if (Program.BuildToolOptions.Action == BuildAction.Server)
+            {
+                throw new Exception("The build tool is already running as a server.");
+            }
+
+            if (!BuildToolAction.InitializeAction())
+            {
+                return 1;
+            }
+
+            Console.WriteLine($"UnrealSharpBuildTool executed {Program.BuildToolOptions.Action.ToString()} action successfully.");
+            return 0;
+        }
+        catch (Exception exception)
+        {
+            Console.WriteLine("An error occurred: " + exception.Message + Environment.NewLine + exception.StackTrace);
+            return 1;
+        }
+    }
+}
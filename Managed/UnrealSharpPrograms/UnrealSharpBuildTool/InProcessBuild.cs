@@ -0,0 +1,80 @@
+using Microsoft.Build.Evaluation;
+using Microsoft.Build.Execution;
+using Microsoft.Build.Framework;
+using Microsoft.Build.Logging;
+
+namespace UnrealSharpBuildTool;
+
+/// <summary>
+/// Builds solutions with an MSBuild instance that the server keeps alive, like the editor module does. MSBuild's JIT,
+/// parsed project files and loaded tasks are reused between requests instead of starting a new dotnet build process every time.
+/// MSBuild's types can't be loaded before <see cref="BuildToolServer"/> has registered MSBuild, so only use this when
+/// <see cref="BuildToolServer.CanBuildInProcess"/> is set.
+/// </summary>
+internal static class InProcessBuild
+{
+    // Created on first use, so one-shot runs of the build tool never touch MSBuild.
+    private static ProjectCollection? _projectCollection;
+    private static BuildManager? _buildManager;
+
+    public static bool TryFindProjectFile(string folder, out string projectFile)
+    {
+        string[] solutionFiles = Directory.GetFiles(folder, "*.sln");
+        string[] candidates = solutionFiles.Length > 0 ? solutionFiles : Directory.GetFiles(folder, "*.csproj");
+
+        // dotnet build refuses to guess between several files as well, leave it to report that.
+        projectFile = candidates.Length == 1 ? candidates[0] : string.Empty;
+        return candidates.Length == 1;
+    }
+
+    public static bool Build(string projectFile, string configuration)
+    {
+        _projectCollection ??= new ProjectCollection();
+        _buildManager ??= new BuildManager("UnrealSharpBuildToolServer");
+
+        ConsoleLogger logger = new ConsoleLogger(LoggerVerbosity.Minimal);
+        BuildParameters buildParameters = new(_projectCollection)
+        {
+            Loggers = new List<ILogger> { logger }
+        };
+
+        Dictionary<string, string?> globalProperties = new()
+        {
+            ["Configuration"] = configuration,
+        };
+
+        _buildManager.BeginBuild(buildParameters);
+
+        try
+        {
+            // Same as the implicit restore of dotnet build, restore runs with its own global properties and its evaluation isn't cached,
+            // so the build below picks up the generated NuGet imports.
+            Dictionary<string, string?> restoreProperties = new(globalProperties)
+            {
+                ["MSBuildRestoreSessionId"] = Guid.NewGuid().ToString("D"),
+                ["MSBuildIsRestoring"] = "true",
+            };
+
+            BuildRequestData restoreRequest = new BuildRequestData(projectFile, restoreProperties, null, new[] { "Restore" }, null,
+                BuildRequestDataFlags.ClearCachesAfterBuild | BuildRequestDataFlags.SkipNonexistentProjects | BuildRequestDataFlags.IgnoreMissingEmptyAndInvalidImports);
+
+            if (_buildManager.BuildRequest(restoreRequest).OverallResult == BuildResultCode.Failure)
+            {
+                throw new Exception($"Failed to restore {projectFile}, see the output above.");
+            }
+
+            BuildRequestData buildRequest = new BuildRequestData(projectFile, globalProperties, null, new[] { "Build" }, null);
+
+            if (_buildManager.BuildRequest(buildRequest).OverallResult == BuildResultCode.Failure)
+            {
+                throw new Exception($"Failed to build {projectFile}, see the output above.");
+            }
+        }
+        finally
+        {
+            _buildManager.EndBuild();
+        }
+
+        return true;
+    }
+}
@@ -9,31 +9,20 @@ public static class Program
 {
     public static BuildToolOptions BuildToolOptions = null!;
 
+    // Set in server mode, output of child processes is forwarded as it arrives instead of when they exit.
+    public static bool StreamProcessOutput;
+
     public static int Main(string[] args)
     {
         try
         {
             Console.WriteLine(">>> UnrealSharpBuildTool");
-            Parser parser = new Parser(with => with.HelpWriter = null);
-            ParserResult<BuildToolOptions> result = parser.ParseArguments<BuildToolOptions>(args);
+            BuildToolOptions = ParseOptions(args);
 
-            if (result.Tag == ParserResultType.NotParsed)
+            if (BuildToolOptions.Action == BuildAction.Server)
             {
-                BuildToolOptions.PrintHelp(result);
-
-                string errors = string.Empty;
-                foreach (Error error in result.Errors)
-                {
-                    if (error is TokenError tokenError)
-                    {
-                        errors += $"{tokenError.Tag}: {tokenError.Token} \n";
-                    }
-                }
-
-                throw new Exception($"Invalid arguments. Errors: {errors}");
+                return BuildToolServer.Run();
             }
-
-            BuildToolOptions = result.Value;
             
             if (!BuildToolAction.InitializeAction())
             {
@@ -51,6 +40,30 @@ public static class Program
         return 0;
     }
 
+    public static BuildToolOptions ParseOptions(string[] args)
+    {
+        Parser parser = new Parser(with => with.HelpWriter = null);
+        ParserResult<BuildToolOptions> result = parser.ParseArguments<BuildToolOptions>(args);
+
+        if (result.Tag == ParserResultType.NotParsed)
+        {
+            BuildToolOptions.PrintHelp(result);
+
+            string errors = string.Empty;
+            foreach (Error error in result.Errors)
+            {
+                if (error is TokenError tokenError)
+                {
+                    errors += $"{tokenError.Tag}: {tokenError.Token} \n";
+                }
+            }
+
+            throw new Exception($"Invalid arguments. Errors: {errors}");
+        }
+
+        return result.Value;
+    }
+
     public static string TryGetArgument(string argument)
     {
         return BuildToolOptions.TryGetArgument(argument);
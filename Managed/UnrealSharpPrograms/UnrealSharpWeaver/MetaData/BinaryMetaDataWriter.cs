@@ -0,0 +1,180 @@
+using System.Text;
+using System.Text.Json;
+using System.Text.Json.Nodes;
+
+namespace UnrealSharpWeaver.MetaData;
+
+/// <summary>
+/// Writes the assembly metadata in a compact binary form that the runtime can read without tokenizing JSON.
+/// The layout mirrors the JSON document, so both files always describe exactly the same data.
+///
+/// Layout (little-endian):
+///   Header:       uint32 Magic, uint32 Version, uint32 NumStrings, uint32 NumNodes, uint32 RootNode
+///   String table: NumStrings x (int32 ByteLength, UTF-8 bytes). Keys, string values and number literals are interned.
+///   Node offsets: NumNodes x uint32, relative to the start of the node data
+///   Node data:    uint8 Kind followed by the payload of the kind, see <see cref="NodeKind"/>
+/// </summary>
+public static class BinaryMetaDataWriter
+{
+    public const uint Magic = 0x444D5355; // "USMD"
+    public const uint Version = 1;
+
+    private enum NodeKind : byte
+    {
+        Null = 0,
+        False = 1,
+        True = 2,
+        Number = 3, // uint32 string index of the number literal
+        String = 4, // uint32 string index
+        Array = 5,  // uint32 count, count x uint32 node index
+        Object = 6, // uint32 count, count x (uint32 key string index, uint32 node index)
+    }
+
+    public static byte[] Write(JsonNode? root)
+    {
+        BinaryMetaDataBuilder builder = new BinaryMetaDataBuilder();
+        uint rootNode = builder.AddNode(root);
+        return builder.ToArray(rootNode);
+    }
+
+    private class BinaryMetaDataBuilder
+    {
+        private readonly Dictionary<string, uint> _stringIndices = new();
+        private readonly List<string> _strings = new();
+        private readonly List<uint> _nodeOffsets = new();
+        private readonly MemoryStream _nodeData = new();
+        private readonly BinaryWriter _nodeWriter;
+
+        public BinaryMetaDataBuilder()
+        {
+            _nodeWriter = new BinaryWriter(_nodeData, Encoding.UTF8);
+        }
+
+        private uint AddString(string value)
+        {
+            if (_stringIndices.TryGetValue(value, out uint index))
+            {
+                return index;
+            }
+
+            index = (uint) _strings.Count;
+            _strings.Add(value);
+            _stringIndices.Add(value, index);
+            return index;
+        }
+
+        public uint AddNode(JsonNode? node)
+        {
+            // Children are written first so a node only ever references nodes that are already in the table.
+            switch (node)
+            {
+                case JsonObject jsonObject:
+                {
+                    List<(uint Key, uint Value)> members = new List<(uint, uint)>(jsonObject.Count);
+                    foreach (KeyValuePair<string, JsonNode?> member in jsonObject)
+                    {
+                        members.Add((AddString(member.Key), AddNode(member.Value)));
+                    }
+
+                    uint nodeIndex = BeginNode(NodeKind.Object);
+                    _nodeWriter.Write((uint) members.Count);
+                    foreach ((uint key, uint value) in members)
+                    {
+                        _nodeWriter.Write(key);
+                        _nodeWriter.Write(value);
+                    }
+
+                    return nodeIndex;
+                }
+                case JsonArray jsonArray:
+                {
+                    List<uint> elements = new List<uint>(jsonArray.Count);
+                    foreach (JsonNode? element in jsonArray)
+                    {
+                        elements.Add(AddNode(element));
+                    }
+
+                    uint nodeIndex = BeginNode(NodeKind.Array);
+                    _nodeWriter.Write((uint) elements.Count);
+                    foreach (uint element in elements)
+                    {
+                        _nodeWriter.Write(element);
+                    }
+
+                    return nodeIndex;
+                }
+                case JsonValue jsonValue:
+                    return AddValue(jsonValue);
+                default:
+                    return BeginNode(NodeKind.Null);
+            }
+        }
+
+        private uint AddValue(JsonValue value)
+        {
+            switch (value.GetValueKind())
+            {
+                case JsonValueKind.True:
+                    return BeginNode(NodeKind.True);
+                case JsonValueKind.False:
+                    return BeginNode(NodeKind.False);
+                case JsonValueKind.String:
+                {
+                    uint stringIndex = AddString(value.GetValue<string>());
+                    uint nodeIndex = BeginNode(NodeKind.String);
+                    _nodeWriter.Write(stringIndex);
+                    return nodeIndex;
+                }
+                case JsonValueKind.Number:
+                {
+                    // Keep the literal so 64-bit flags survive without going through a double.
+                    uint stringIndex = AddString(value.ToJsonString());
+                    uint nodeIndex = BeginNode(NodeKind.Number);
+                    _nodeWriter.Write(stringIndex);
+                    return nodeIndex;
+                }
+                default:
+                    return BeginNode(NodeKind.Null);
+            }
+        }
+
+        private uint BeginNode(NodeKind kind)
+        {
+            uint nodeIndex = (uint) _nodeOffsets.Count;
+            _nodeWriter.Flush();
+            _nodeOffsets.Add((uint) _nodeData.Length);
+            _nodeWriter.Write((byte) kind);
+            return nodeIndex;
+        }
+
+        public byte[] ToArray(uint rootNode)
+        {
+            _nodeWriter.Flush();
+
+            using MemoryStream output = new MemoryStream();
+            using BinaryWriter writer = new BinaryWriter(output, Encoding.UTF8);
+
+            writer.Write(Magic);
+            writer.Write(Version);
+            writer.Write((uint) _strings.Count);
+            writer.Write((uint) _nodeOffsets.Count);
+            writer.Write(rootNode);
+
+            foreach (string value in _strings)
+            {
+                byte[] bytes = Encoding.UTF8.GetBytes(value);
+                writer.Write(bytes.Length);
+                writer.Write(bytes);
+            }
+
+            foreach (uint offset in _nodeOffsets)
+            {
+                writer.Write(offset);
+            }
+
+            writer.Write(_nodeData.GetBuffer(), 0, (int) _nodeData.Length);
+            writer.Flush();
+            return output.ToArray();
+        }
+    }
+}
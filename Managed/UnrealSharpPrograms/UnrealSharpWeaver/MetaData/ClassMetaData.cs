@@ -14,6 +14,7 @@ public class ClassMetaData : TypeReferenceMetadata
     public List<TypeReferenceMetadata> Interfaces { get; set; }
     public string ConfigCategory { get; set; } 
     public ClassFlags ClassFlags { get; set; }
+    public int ManagedObjectPoolSize { get; set; }
     
     // Non-serialized for JSON
     public bool HasProperties => Properties.Count > 0;
@@ -36,6 +37,7 @@ public class ClassMetaData : TypeReferenceMetadata
         PopulateFunctions();
         
         AddConfigCategory();
+        AddManagedObjectPoolSize();
         
         ParentClass = new TypeReferenceMetadata(type.BaseType.Resolve());
         ClassFlags |= GetClassFlags(type, AttributeName) | ClassFlags.CompiledFromBlueprint;
@@ -63,6 +65,16 @@ public class ClassMetaData : TypeReferenceMetadata
         }
     }
 
+    private void AddManagedObjectPoolSize()
+    {
+        CustomAttribute uClassAttribute = _classDefinition.GetUClass()!;
+        CustomAttributeArgument? poolSizeProperty = uClassAttribute.FindAttributeField(nameof(ManagedObjectPoolSize));
+        if (poolSizeProperty != null)
+        {
+            ManagedObjectPoolSize = (int) poolSizeProperty.Value.Value;
+        }
+    }
+
     private void PopulateProperties()
     {
         if (_classDefinition.Properties.Count == 0)
@@ -0,0 +1,116 @@
+using System.Text;
+using System.Text.Json.Nodes;
+
+namespace UnrealSharpWeaver.MetaData;
+
+/// <summary>
+/// Adds a content hash and a dependency list to every type in the serialized assembly metadata.
+/// The runtime uses them on hot reload to skip types that haven't changed and to rebuild
+/// the types that depend on the ones that have.
+/// </summary>
+public static class TypeContentHasher
+{
+    private static readonly string[] TypeSections =
+    [
+        nameof(ApiMetaData.StructMetaData),
+        nameof(ApiMetaData.EnumMetaData),
+        nameof(ApiMetaData.InterfacesMetaData),
+        nameof(ApiMetaData.DelegateMetaData),
+        nameof(ApiMetaData.ClassMetaData),
+    ];
+
+    public static void AddContentHashes(JsonNode? metadata)
+    {
+        if (metadata is not JsonObject metadataObject)
+        {
+            return;
+        }
+
+        foreach (string section in TypeSections)
+        {
+            if (metadataObject[section] is not JsonArray types)
+            {
+                continue;
+            }
+
+            foreach (JsonNode? type in types)
+            {
+                if (type is JsonObject typeObject)
+                {
+                    AddContentHash(typeObject);
+                }
+            }
+        }
+    }
+
+    private static void AddContentHash(JsonObject typeObject)
+    {
+        // Hash before adding the new fields, the serialized type covers properties, functions and metadata.
+        ulong contentHash = HashString(typeObject.ToJsonString());
+
+        string name = typeObject["Name"]?.GetValue<string>() ?? string.Empty;
+        string ns = typeObject["Namespace"]?.GetValue<string>() ?? string.Empty;
+
+        JsonArray dependencies = new JsonArray();
+        HashSet<(string, string)> visited = [(name, ns)];
+        CollectDependencies(typeObject, dependencies, visited);
+
+        typeObject["ContentHash"] = contentHash.ToString("x16");
+        typeObject["Dependencies"] = dependencies;
+    }
+
+    private static void CollectDependencies(JsonNode? node, JsonArray dependencies, HashSet<(string, string)> visited)
+    {
+        switch (node)
+        {
+            case JsonObject jsonObject:
+            {
+                // Type references are the only objects that carry an assembly name next to a name and namespace.
+                if (jsonObject["AssemblyName"] is JsonValue assemblyName
+                    && jsonObject["Name"] is JsonValue name
+                    && jsonObject["Namespace"] is JsonValue ns
+                    && visited.Add((name.GetValue<string>(), ns.GetValue<string>())))
+                {
+                    dependencies.Add(new JsonObject
+                    {
+                        ["Name"] = name.GetValue<string>(),
+                        ["Namespace"] = ns.GetValue<string>(),
+                        ["AssemblyName"] = assemblyName.GetValue<string>(),
+                    });
+                }
+
+                foreach (KeyValuePair<string, JsonNode?> member in jsonObject)
+                {
+                    CollectDependencies(member.Value, dependencies, visited);
+                }
+
+                break;
+            }
+            case JsonArray jsonArray:
+            {
+                foreach (JsonNode? element in jsonArray)
+                {
+                    CollectDependencies(element, dependencies, visited);
+                }
+
+                break;
+            }
+        }
+    }
+
+    // FNV-1a, stable across runs and processes unlike string.GetHashCode.
+    private static ulong HashString(string value)
+    {
+        const ulong offsetBasis = 14695981039346656037;
+        const ulong prime = 1099511628211;
+
+        ulong hash = offsetBasis;
+        foreach (byte b in Encoding.UTF8.GetBytes(value))
+        {
+            hash ^= b;
+            hash *= prime;
+        }
+
+        return hash;
+    }
+}
@@ -3,4 +3,7 @@
 public class UnrealSharpMetadata
 {
     public ICollection<string> AssemblyLoadingOrder { get; set; } = [];
-}
\ No newline at end of file
+
+    // The user assemblies each assembly references. Assemblies that don't depend on each other are loaded in parallel.
+    public IDictionary<string, ICollection<string>> AssemblyDependencies { get; set; } = new Dictionary<string, ICollection<string>>();
+}
@@ -1,4 +1,5 @@
 using System.Text.Json;
+using System.Text.Json.Nodes;
 using Mono.Cecil;
 using Mono.Cecil.Pdb;
 using UnrealSharpWeaver.MetaData;
@@ -91,6 +92,7 @@ public static class Program
         {
             AssemblyLoadingOrder = orderedAssemblies
                 .Select(x => Path.GetFileNameWithoutExtension(x.MainModule.FileName)).ToList(),
+            AssemblyDependencies = GetUserAssemblyDependencies(orderedAssemblies),
         };
 
         string metaDataContent = JsonSerializer.Serialize(unrealSharpMetadata, new JsonSerializerOptions
@@ -102,6 +104,32 @@ public static class Program
         File.WriteAllText(fileName, metaDataContent);
     }
 
+    private static IDictionary<string, ICollection<string>> GetUserAssemblyDependencies(ICollection<AssemblyDefinition> assemblies)
+    {
+        Dictionary<string, string> userAssemblyNames = new Dictionary<string, string>();
+        foreach (AssemblyDefinition assembly in assemblies)
+        {
+            userAssemblyNames[assembly.FullName] = Path.GetFileNameWithoutExtension(assembly.MainModule.FileName);
+        }
+
+        Dictionary<string, ICollection<string>> dependencies = new Dictionary<string, ICollection<string>>(assemblies.Count);
+        foreach (AssemblyDefinition assembly in assemblies)
+        {
+            List<string> references = new List<string>();
+            foreach (AssemblyNameReference reference in assembly.MainModule.AssemblyReferences)
+            {
+                if (userAssemblyNames.TryGetValue(reference.FullName, out string? referenceName))
+                {
+                    references.Add(referenceName);
+                }
+            }
+
+            dependencies[userAssemblyNames[assembly.FullName]] = references;
+        }
+
+        return dependencies;
+    }
+
     private static void ProcessOrderedAssemblies(ICollection<AssemblyDefinition> assemblies, DirectoryInfo outputDirectory)
     {
         Exception? exception = null;
@@ -331,6 +359,8 @@ public static class Program
         assembly.Write(assemblyOutputPath, new WriterParameters
         {
             SymbolWriterProvider = new PdbWriterProvider(),
+            // Unchanged input gives a byte-identical output, so hot reload can skip the assembly.
+            DeterministicMvid = true,
         });
 
         WriteAssemblyMetaDataFile(assemblyMetaData, assemblyOutputPath);
@@ -338,13 +368,20 @@ public static class Program
 
     private static void WriteAssemblyMetaDataFile(ApiMetaData metadata, string outputPath)
     {
-        string metaDataContent = JsonSerializer.Serialize(metadata, new JsonSerializerOptions
+        JsonSerializerOptions options = new JsonSerializerOptions
         {
             WriteIndented = false,
-        });
+        };
+        
+        JsonNode? metaDataNode = JsonSerializer.SerializeToNode(metadata, options);
+        TypeContentHasher.AddContentHashes(metaDataNode);
 
         string metadataFilePath = Path.ChangeExtension(outputPath, "metadata.json");
-        File.WriteAllText(metadataFilePath, metaDataContent);
+        File.WriteAllText(metadataFilePath, metaDataNode?.ToJsonString(options) ?? string.Empty);
+
+        // The runtime prefers the binary file and falls back to the JSON file if it's missing or outdated.
+        string binaryMetadataFilePath = Path.ChangeExtension(outputPath, "metadata.bin");
+        File.WriteAllBytes(binaryMetadataFilePath, BinaryMetaDataWriter.Write(metaDataNode));
     }
 
     private static void StartProcessingAssembly(AssemblyDefinition userAssembly, ApiMetaData metadata)
@@ -1,5 +1,7 @@
 #include "CSBindsManager.h"
 #include "UnrealSharpBinds.h"
+#include "Algo/BinarySearch.h"
+#include "Misc/ScopeRWLock.h"
 
 FCSBindsManager* FCSBindsManager::BindsManagerInstance = nullptr;
 
@@ -16,42 +18,179 @@ FCSBindsManager* FCSBindsManager::Get()
 void FCSBindsManager::RegisterExportedFunction(const FName& ClassName, const FCSExportedFunction& ExportedFunction)
 {
 	FCSBindsManager* Instance = Get();
+	FWriteScopeLock WriteLock(Instance->IndexLock);
+	
 	TArray<FCSExportedFunction>& ExportedFunctions = Instance->ExportedFunctionsMap.FindOrAdd(ClassName);
 	ExportedFunctions.Add(ExportedFunction);
+	Instance->bIsIndexDirty = true;
 }
 
 void* FCSBindsManager::GetBoundFunction(const TCHAR* InOuterName, const TCHAR* InFunctionName, int32 ManagedFunctionSize)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSBindsManager::GetBoundFunction);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 	
 	FCSBindsManager* Instance = Get();
-	FName ManagedOuterName = FName(InOuterName);
-	FName ManagedFunctionName = FName(InFunctionName);
+	Instance->BuildIndexIfNeeded();
+
+	void* FunctionPointer;
+	{
+		FReadScopeLock ReadLock(Instance->IndexLock);
+		FunctionPointer = Instance->ResolveFunction(InOuterName, InFunctionName, FCString::Strlen(InFunctionName), ManagedFunctionSize);
+	}
+
+	Instance->NumResolvedFunctions.fetch_add(1, std::memory_order_relaxed);
+	Instance->ResolveCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+	return FunctionPointer;
+}
+
+int32 FCSBindsManager::GetBoundFunctions(const TCHAR* InOuterName, const TCHAR* InFunctionNames, const int32* ManagedFunctionSizes, int32 NumFunctions, void** OutFunctionPointers)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSBindsManager::GetBoundFunctions);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
 	
-	TArray<FCSExportedFunction>* ExportedFunctions = Instance->ExportedFunctionsMap.Find(ManagedOuterName);
+	FCSBindsManager* Instance = Get();
+	Instance->BuildIndexIfNeeded();
+	FReadScopeLock ReadLock(Instance->IndexLock);
 
-	if (!ExportedFunctions)
+	int32 NumResolved = 0;
+	const TCHAR* FunctionName = InFunctionNames;
+	
+	for (int32 i = 0; i < NumFunctions; ++i)
 	{
-		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No exported functions found for %s"), InOuterName);
-		return nullptr;
+		const int32 FunctionNameLength = FCString::Strlen(FunctionName);
+		OutFunctionPointers[i] = Instance->ResolveFunction(InOuterName, FunctionName, FunctionNameLength, ManagedFunctionSizes[i]);
+
+		if (OutFunctionPointers[i])
+		{
+			NumResolved++;
+		}
+
+		// Skip past the null separator to the next name.
+		FunctionName += FunctionNameLength + 1;
+	}
+
+	Instance->NumResolvedFunctions.fetch_add(NumFunctions, std::memory_order_relaxed);
+	Instance->ResolveCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+	return NumResolved;
+}
+
+const FCSBindsCallbacks& FCSBindsManager::GetBindsCallbacks()
+{
+	static FCSBindsCallbacks BindsCallbacks { &FCSBindsManager::GetBoundFunction, &FCSBindsManager::GetBoundFunctions };
+	return BindsCallbacks;
+}
+
+int32 FCSBindsManager::GetNumResolvedFunctions()
+{
+	return Get()->NumResolvedFunctions.load(std::memory_order_relaxed);
+}
+
+double FCSBindsManager::GetResolveTimeSeconds()
+{
+	return FPlatformTime::ToSeconds64(Get()->ResolveCycles.load(std::memory_order_relaxed));
+}
+
+uint32 FCSBindsManager::HashBindingName(const TCHAR* OuterName, const TCHAR* FunctionName, int32 FunctionNameLength)
+{
+	// Case-insensitive FNV-1a, to match the FName comparison the bindings were previously looked up with.
+	uint32 Hash = 2166136261u;
+	
+	for (const TCHAR* Char = OuterName; *Char; ++Char)
+	{
+		Hash = (Hash ^ static_cast<uint32>(FChar::ToLower(*Char))) * 16777619u;
+	}
+
+	Hash = (Hash ^ static_cast<uint32>('.')) * 16777619u;
+
+	for (int32 i = 0; i < FunctionNameLength; ++i)
+	{
+		Hash = (Hash ^ static_cast<uint32>(FChar::ToLower(FunctionName[i]))) * 16777619u;
+	}
+
+	return Hash;
+}
+
+void FCSBindsManager::BuildIndexIfNeeded()
+{
+	if (!bIsIndexDirty)
+	{
+		return;
+	}
+
+	FWriteScopeLock WriteLock(IndexLock);
+
+	// Another thread may have rebuilt it while we waited for the lock.
+	if (!bIsIndexDirty)
+	{
+		return;
 	}
 
-	for (FCSExportedFunction& NativeFunction : *ExportedFunctions)
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSBindsManager::BuildIndex);
+
+	SortedFunctions.Reset();
+	for (const TPair<FName, TArray<FCSExportedFunction>>& Pair : ExportedFunctionsMap)
+	{
+		const FString OuterName = Pair.Key.ToString();
+		
+		for (const FCSExportedFunction& ExportedFunction : Pair.Value)
+		{
+			FString FunctionName = ExportedFunction.Name.ToString();
+			const uint32 Hash = HashBindingName(*OuterName, *FunctionName, FunctionName.Len());
+			SortedFunctions.Add({ Hash, OuterName, MoveTemp(FunctionName), ExportedFunction });
+		}
+	}
+
+	SortedFunctions.Sort([](const FCSIndexedFunction& A, const FCSIndexedFunction& B)
+	{
+		return A.Hash < B.Hash;
+	});
+
+	bIsIndexDirty = false;
+}
+
+const FCSBindsManager::FCSIndexedFunction* FCSBindsManager::FindIndexedFunction(const TCHAR* InOuterName, const TCHAR* InFunctionName, int32 FunctionNameLength) const
+{
+	const uint32 Hash = HashBindingName(InOuterName, InFunctionName, FunctionNameLength);
+	
+	for (int32 Index = Algo::LowerBoundBy(SortedFunctions, Hash, &FCSIndexedFunction::Hash); Index < SortedFunctions.Num(); ++Index)
 	{
-		if (NativeFunction.Name != ManagedFunctionName)
+		const FCSIndexedFunction& IndexedFunction = SortedFunctions[Index];
+		
+		if (IndexedFunction.Hash != Hash)
 		{
-			continue;
+			break;
 		}
-			
-		if (NativeFunction.Size != ManagedFunctionSize)
+
+		if (IndexedFunction.FunctionName.Len() == FunctionNameLength
+			&& FCString::Strnicmp(*IndexedFunction.FunctionName, InFunctionName, FunctionNameLength) == 0
+			&& FCString::Stricmp(*IndexedFunction.OuterName, InOuterName) == 0)
 		{
-			UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: Function size mismatch for %s::%s."), InOuterName, InFunctionName);
-			return nullptr;
+			return &IndexedFunction;
 		}
-			
-		return NativeFunction.FunctionPointer;
 	}
 
-	UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No function found for %s.%s"), *ManagedOuterName.ToString(), *ManagedFunctionName.ToString());
 	return nullptr;
 }
+
+void* FCSBindsManager::ResolveFunction(const TCHAR* InOuterName, const TCHAR* InFunctionName, int32 FunctionNameLength, int32 ManagedFunctionSize) const
+{
+	const FCSIndexedFunction* IndexedFunction = FindIndexedFunction(InOuterName, InFunctionName, FunctionNameLength);
+
+	if (!IndexedFunction)
+	{
+		const FString FunctionName(FunctionNameLength, InFunctionName);
+		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: No function found for %s.%s"), InOuterName, *FunctionName);
+		return nullptr;
+	}
+
+	if (IndexedFunction->ExportedFunction.Size != ManagedFunctionSize)
+	{
+		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to get BoundNativeFunction: Function size mismatch for %s::%s."), InOuterName, *IndexedFunction->FunctionName);
+		return nullptr;
+	}
+
+	return IndexedFunction->ExportedFunction.GetFunctionPointer();
+}
@@ -9,3 +9,27 @@ FCSExportedFunction::FCSExportedFunction(const FName& OuterName, const FName& Na
 {
 	FCSBindsManager::RegisterExportedFunction(OuterName, *this);
 }
+
+#if UNREALSHARP_WITH_INTEROP_PROFILER
+FCSExportedFunction::FCSExportedFunction(const FName& OuterName, const FName& Name, void* InFunctionPointer, int32 InSize, void* InProfiledFunctionPointer, FCSInteropFunctionStats* Stats):
+	Name(Name),
+	FunctionPointer(InFunctionPointer),
+	Size(InSize),
+	ProfiledFunctionPointer(InProfiledFunctionPointer)
+{
+	FCSInteropProfiler::RegisterFunction(OuterName, Name, Stats);
+	FCSBindsManager::RegisterExportedFunction(OuterName, *this);
+}
+#endif
+
+void* FCSExportedFunction::GetFunctionPointer() const
+{
+#if UNREALSHARP_WITH_INTEROP_PROFILER
+	if (ProfiledFunctionPointer && FCSInteropProfiler::IsEnabled())
+	{
+		return ProfiledFunctionPointer;
+	}
+#endif
+
+	return FunctionPointer;
+}
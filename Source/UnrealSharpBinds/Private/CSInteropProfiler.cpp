@@ -0,0 +1,147 @@
+#include "CSInteropProfiler.h"
+
+#if UNREALSHARP_WITH_INTEROP_PROFILER
+
+#include "UnrealSharpBinds.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UE_TRACE_CHANNEL_DEFINE(UnrealSharpInteropChannel);
+
+namespace
+{
+	// Function-local so registrations from static initializers in other modules can't run before it's constructed.
+	TArray<FCSInteropFunctionStats*>& GetRegisteredFunctions()
+	{
+		static TArray<FCSInteropFunctionStats*> RegisteredFunctions;
+		return RegisteredFunctions;
+	}
+
+	void CreateStatAndTraceEvent(FCSInteropFunctionStats& Stats)
+	{
+		const FString DisplayName = FString::Printf(TEXT("%s.%s"), *Stats.OuterName.ToString(), *Stats.FunctionName.ToString());
+
+#if STATS
+		Stats.StatId = FDynamicStats::CreateStatId<FStatGroup_STATGROUP_UnrealSharpInterop>(DisplayName);
+#endif
+
+#if CPUPROFILERTRACE_ENABLED
+		Stats.TraceSpecId = FCpuProfilerTrace::OutputEventType(*DisplayName);
+#endif
+	}
+
+	FAutoConsoleCommand DumpCsvCommand(
+		TEXT("UnrealSharp.Interop.DumpCsv"),
+		TEXT("Writes the exported functions called from C# with the highest inclusive time as CSV. Usage: UnrealSharp.Interop.DumpCsv [NumFunctions]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FCSInteropProfiler::DumpCsv(Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 50);
+		}));
+
+	FAutoConsoleCommand ResetCommand(
+		TEXT("UnrealSharp.Interop.Reset"),
+		TEXT("Resets the call counters of the exported functions called from C#."),
+		FConsoleCommandDelegate::CreateStatic(&FCSInteropProfiler::Reset));
+}
+
+bool FCSInteropProfiler::bIsInitialized = false;
+bool FCSInteropProfiler::bIsEnabled = false;
+
+void FCSInteropProfiler::Initialize()
+{
+	// Exported functions register from static initializers, which can run before the command line is set
+	// and before the stats system is ready. Decide and create the stats once the module starts up.
+	bIsEnabled = FParse::Param(FCommandLine::Get(), TEXT("UnrealSharpInteropProfiling"));
+	bIsInitialized = true;
+
+	if (!bIsEnabled)
+	{
+		return;
+	}
+
+	for (FCSInteropFunctionStats* Stats : GetRegisteredFunctions())
+	{
+		CreateStatAndTraceEvent(*Stats);
+	}
+
+	UE_LOG(LogUnrealSharpBinds, Display, TEXT("Interop profiling enabled for %d exported functions."), GetRegisteredFunctions().Num());
+}
+
+void FCSInteropProfiler::RegisterFunction(const FName& OuterName, const FName& FunctionName, FCSInteropFunctionStats* Stats)
+{
+	Stats->OuterName = OuterName;
+	Stats->FunctionName = FunctionName;
+	GetRegisteredFunctions().Add(Stats);
+
+	// Modules loaded after startup register here directly.
+	if (bIsInitialized && bIsEnabled)
+	{
+		CreateStatAndTraceEvent(*Stats);
+	}
+}
+
+void FCSInteropProfiler::DumpCsv(int32 NumFunctions)
+{
+	if (!IsEnabled())
+	{
+		UE_LOG(LogUnrealSharpBinds, Warning, TEXT("Interop profiling is disabled. Run with -UnrealSharpInteropProfiling to record calls to exported functions."));
+		return;
+	}
+
+	TArray<FCSInteropFunctionStats*> SortedFunctions = GetRegisteredFunctions().FilterByPredicate([](const FCSInteropFunctionStats* Stats)
+	{
+		return Stats->NumCalls.load(std::memory_order_relaxed) > 0;
+	});
+
+	SortedFunctions.Sort([](const FCSInteropFunctionStats& A, const FCSInteropFunctionStats& B)
+	{
+		return A.InclusiveCycles.load(std::memory_order_relaxed) > B.InclusiveCycles.load(std::memory_order_relaxed);
+	});
+
+	if (NumFunctions > 0 && SortedFunctions.Num() > NumFunctions)
+	{
+		SortedFunctions.SetNum(NumFunctions);
+	}
+
+	FString Csv = TEXT("Outer,Function,Calls,GameThreadCalls,OtherThreadCalls,InclusiveMs,AverageUs\n");
+	for (const FCSInteropFunctionStats* Stats : SortedFunctions)
+	{
+		const uint64 NumCalls = Stats->NumCalls.load(std::memory_order_relaxed);
+		const uint64 NumGameThreadCalls = Stats->NumGameThreadCalls.load(std::memory_order_relaxed);
+		const double InclusiveSeconds = FPlatformTime::ToSeconds64(Stats->InclusiveCycles.load(std::memory_order_relaxed));
+
+		Csv += FString::Printf(TEXT("%s,%s,%llu,%llu,%llu,%.3f,%.3f\n"),
+			*Stats->OuterName.ToString(),
+			*Stats->FunctionName.ToString(),
+			NumCalls,
+			NumGameThreadCalls,
+			NumCalls - NumGameThreadCalls,
+			InclusiveSeconds * 1000.0,
+			InclusiveSeconds * 1000000.0 / NumCalls);
+	}
+
+	const FString FilePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("UnrealSharp"), FString::Printf(TEXT("InteropProfile-%s.csv"), *FDateTime::Now().ToString()));
+
+	if (!FFileHelper::SaveStringToFile(Csv, *FilePath))
+	{
+		UE_LOG(LogUnrealSharpBinds, Error, TEXT("Failed to write interop profile to %s"), *FilePath);
+		return;
+	}
+
+	UE_LOG(LogUnrealSharpBinds, Display, TEXT("Wrote %d exported functions to %s"), SortedFunctions.Num(), *FilePath);
+}
+
+void FCSInteropProfiler::Reset()
+{
+	for (FCSInteropFunctionStats* Stats : GetRegisteredFunctions())
+	{
+		Stats->NumCalls.store(0, std::memory_order_relaxed);
+		Stats->NumGameThreadCalls.store(0, std::memory_order_relaxed);
+		Stats->InclusiveCycles.store(0, std::memory_order_relaxed);
+	}
+}
+
+#endif
@@ -1,4 +1,5 @@
 ﻿#include "UnrealSharpBinds.h"
+#include "CSInteropProfiler.h"
 
 #define LOCTEXT_NAMESPACE "FUnrealSharpBindsModule"
 
@@ -6,6 +7,9 @@ DEFINE_LOG_CATEGORY(LogUnrealSharpBinds);
 
 void FUnrealSharpBindsModule::StartupModule()
 {
+#if UNREALSHARP_WITH_INTEROP_PROFILER
+	FCSInteropProfiler::Initialize();
+#endif
 }
 
 void FUnrealSharpBindsModule::ShutdownModule()
@@ -1,11 +1,22 @@
 #pragma once
 
 #include "CSExportedFunction.h"
+#include <atomic>
 
 // Native bound function. If you want to bind a function to C#, use this macro.
 // The managed delegate signature must match the native function signature + outer name, and all params need to be blittable.
 #define UNREALSHARP_FUNCTION()
 
+// Function pointers handed to C# for resolving bound functions.
+struct FCSBindsCallbacks
+{
+	using GetBoundFunctionCallback = void*(*)(const TCHAR*, const TCHAR*, int32);
+	using GetBoundFunctionsCallback = int32(*)(const TCHAR*, const TCHAR*, const int32*, int32, void**);
+
+	GetBoundFunctionCallback GetBoundFunction = nullptr;
+	GetBoundFunctionsCallback GetBoundFunctions = nullptr;
+};
+
 class FCSBindsManager
 {
 public:
@@ -16,8 +27,44 @@ public:
 
 	UNREALSHARPBINDS_API static void* GetBoundFunction(const TCHAR* InOuterName, const TCHAR* InFunctionName, int32 ManagedFunctionSize);
 
+	// Resolves all functions of an outer in one call. InFunctionNames is a list of names separated by null characters.
+	// Returns the number of functions that were resolved, unresolved entries in OutFunctionPointers are set to null.
+	UNREALSHARPBINDS_API static int32 GetBoundFunctions(const TCHAR* InOuterName, const TCHAR* InFunctionNames, const int32* ManagedFunctionSizes, int32 NumFunctions, void** OutFunctionPointers);
+
+	UNREALSHARPBINDS_API static const FCSBindsCallbacks& GetBindsCallbacks();
+
+	// Total number of bound functions resolved by C# and the time spent resolving them.
+	UNREALSHARPBINDS_API static int32 GetNumResolvedFunctions();
+	UNREALSHARPBINDS_API static double GetResolveTimeSeconds();
+
 private:
 	FCSBindsManager() = default;
+
+	struct FCSIndexedFunction
+	{
+		uint32 Hash;
+		FString OuterName;
+		FString FunctionName;
+		FCSExportedFunction ExportedFunction;
+	};
+
+	static uint32 HashBindingName(const TCHAR* OuterName, const TCHAR* FunctionName, int32 FunctionNameLength);
+
+	void BuildIndexIfNeeded();
+	const FCSIndexedFunction* FindIndexedFunction(const TCHAR* InOuterName, const TCHAR* InFunctionName, int32 FunctionNameLength) const;
+	void* ResolveFunction(const TCHAR* InOuterName, const TCHAR* InFunctionName, int32 FunctionNameLength, int32 ManagedFunctionSize) const;
+
 	static FCSBindsManager* BindsManagerInstance;
 	TMap<FName, TArray<FCSExportedFunction>> ExportedFunctionsMap;
+
+	// Immutable lookup table sorted by hash, rebuilt when new functions are registered after it was built.
+	TArray<FCSIndexedFunction> SortedFunctions;
+	std::atomic<bool> bIsIndexDirty { true };
+
+	// Bindings are resolved from C# static constructors, which can run on any thread.
+	// Lookups take it for reading, registration and rebuilding the index for writing.
+	FRWLock IndexLock;
+
+	std::atomic<int32> NumResolvedFunctions { 0 };
+	std::atomic<uint64> ResolveCycles { 0 };
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "CSInteropProfiler.h"
+
 /**
  * Thin wrapper around sizeof(T) used for getting the size of a function's arguments.
  * @tparam T The type we want the size of
@@ -47,4 +49,28 @@ struct UNREALSHARPBINDS_API FCSExportedFunction
 	int32 Size;
 
 	FCSExportedFunction(const FName& OuterName, const FName& Name, void* InFunctionPointer, int32 InSize);
+
+#if UNREALSHARP_WITH_INTEROP_PROFILER
+	// Instrumented thunk handed out instead of FunctionPointer when interop profiling is enabled.
+	void* ProfiledFunctionPointer = nullptr;
+
+	FCSExportedFunction(const FName& OuterName, const FName& Name, void* InFunctionPointer, int32 InSize, void* InProfiledFunctionPointer, FCSInteropFunctionStats* Stats);
+#endif
+
+	void* GetFunctionPointer() const;
 };
+
+/**
+ * Creates and registers the exported function, along with its instrumented thunk in non-shipping builds.
+ * @tparam Function The native function to export
+ */
+template <auto Function>
+FCSExportedFunction MakeExportedFunction(const FName& OuterName, const FName& Name)
+{
+#if UNREALSHARP_WITH_INTEROP_PROFILER
+	using FThunk = TCSInteropThunk<Function>;
+	return FCSExportedFunction(OuterName, Name, (void*)Function, GetFunctionSize(Function), (void*)&FThunk::Invoke, &FThunk::GetStats());
+#else
+	return FCSExportedFunction(OuterName, Name, (void*)Function, GetFunctionSize(Function));
+#endif
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <atomic>
+
+// Instrumented thunks for the functions exported with UNREALSHARP_FUNCTION. Compiled out in shipping builds.
+#define UNREALSHARP_WITH_INTEROP_PROFILER !UE_BUILD_SHIPPING
+
+#if UNREALSHARP_WITH_INTEROP_PROFILER
+
+DECLARE_STATS_GROUP(TEXT("UnrealSharp Interop"), STATGROUP_UnrealSharpInterop, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(UnrealSharpInteropChannel, UNREALSHARPBINDS_API);
+
+struct FCSInteropFunctionStats
+{
+	FName OuterName;
+	FName FunctionName;
+
+	std::atomic<uint64> NumCalls { 0 };
+	std::atomic<uint64> NumGameThreadCalls { 0 };
+	std::atomic<uint64> InclusiveCycles { 0 };
+
+	// Set when the function is registered with the profiler, so they are never created on the hot path.
+	TStatId StatId;
+	uint32 TraceSpecId = 0;
+};
+
+/**
+ * Records a single call into an exported function: call count, inclusive time and whether it was made from the game thread.
+ * Also emits a cycle stat and an Insights event when the stat group or the trace channel are enabled.
+ */
+class FCSInteropScope
+{
+public:
+	explicit FCSInteropScope(FCSInteropFunctionStats& InStats)
+		: Stats(InStats)
+#if STATS
+		, CycleCounter(InStats.StatId)
+#endif
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+#if CPUPROFILERTRACE_ENABLED
+		bTraceEvent = Stats.TraceSpecId != 0 && UE_TRACE_CHANNELEXPR_IS_ENABLED(UnrealSharpInteropChannel);
+		if (bTraceEvent)
+		{
+			FCpuProfilerTrace::OutputBeginEvent(Stats.TraceSpecId);
+		}
+#endif
+	}
+
+	~FCSInteropScope()
+	{
+#if CPUPROFILERTRACE_ENABLED
+		if (bTraceEvent)
+		{
+			FCpuProfilerTrace::OutputEndEvent();
+		}
+#endif
+		Stats.InclusiveCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+		Stats.NumCalls.fetch_add(1, std::memory_order_relaxed);
+
+		if (IsInGameThread())
+		{
+			Stats.NumGameThreadCalls.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	FCSInteropFunctionStats& Stats;
+#if STATS
+	FScopeCycleCounter CycleCounter;
+#endif
+	uint64 StartCycles;
+#if CPUPROFILERTRACE_ENABLED
+	bool bTraceEvent = false;
+#endif
+};
+
+/**
+ * Wraps an exported function in a thunk with the same signature that records its calls.
+ * One instantiation per exported function, so every binding gets its own counters.
+ */
+template <auto Function>
+struct TCSInteropThunk;
+
+template <typename ReturnType, typename... Args, ReturnType (*Function)(Args...)>
+struct TCSInteropThunk<Function>
+{
+	// Function-local, so it's constructed on first use. The functions are registered from static initializers in other
+	// translation units, and the dynamic initialization of a static data member could run after that and reset the names.
+	static FCSInteropFunctionStats& GetStats()
+	{
+		static FCSInteropFunctionStats Stats;
+		return Stats;
+	}
+
+	static ReturnType Invoke(Args... Arguments)
+	{
+		FCSInteropScope Scope(GetStats());
+		return Function(Forward<Args>(Arguments)...);
+	}
+};
+
+class FCSInteropProfiler
+{
+public:
+	// Reads -UnrealSharpInteropProfiling and creates the stats and trace events of the functions registered so far.
+	static void Initialize();
+
+	// Called when an exported function is registered. Creates the stat and trace event for the function.
+	UNREALSHARPBINDS_API static void RegisterFunction(const FName& OuterName, const FName& FunctionName, FCSInteropFunctionStats* Stats);
+
+	// True if the bindings should be resolved to their instrumented thunks. Enabled with -UnrealSharpInteropProfiling.
+	static bool IsEnabled() { return bIsEnabled; }
+
+	// Writes the top N functions by inclusive time as CSV to the profiling directory. NumFunctions <= 0 writes all of them.
+	UNREALSHARPBINDS_API static void DumpCsv(int32 NumFunctions);
+
+	UNREALSHARPBINDS_API static void Reset();
+
+private:
+	UNREALSHARPBINDS_API static bool bIsInitialized;
+	UNREALSHARPBINDS_API static bool bIsEnabled;
+};
+
+#endif
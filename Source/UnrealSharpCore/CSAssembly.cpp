@@ -1,6 +1,10 @@
 ﻿#include "CSAssembly.h"
 #include "UnrealSharpCore.h"
 #include "Misc/Paths.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Parse.h"
+#include "HAL/FileManager.h"
+#include "Hash/xxhash.h"
 #include "CSManager.h"
 #include "CSUnrealSharpSettings.h"
 #include "Logging/StructuredLog.h"
@@ -8,6 +12,7 @@
 #include "TypeGenerator/CSEnum.h"
 #include "TypeGenerator/CSInterface.h"
 #include "TypeGenerator/CSScriptStruct.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 #include "TypeGenerator/Register/MetaData/CSClassMetaData.h"
 #include "TypeGenerator/Register/MetaData/CSDelegateMetaData.h"
 #include "TypeGenerator/Register/MetaData/CSEnumMetaData.h"
@@ -43,6 +48,13 @@ bool UCSAssembly::LoadAssembly(bool bisCollectible)
 		return true;
 	}
 
+	return LoadManagedAssembly(bisCollectible) && FinishLoadingAssembly();
+}
+
+bool UCSAssembly::LoadManagedAssembly(bool bIsCollectible)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(TEXT("UCSAssembly::LoadManagedAssembly: " + AssemblyName.ToString())));
+
 	if (!FPaths::FileExists(AssemblyPath))
 	{
 		UE_LOG(LogUnrealSharp, Display, TEXT("%s doesn't exist"), *AssemblyPath);
@@ -50,7 +62,10 @@ bool UCSAssembly::LoadAssembly(bool bisCollectible)
 	}
 
 	bIsLoading = true;
-	FGCHandle NewHandle = UCSManager::Get().GetManagedPluginsCallbacks().LoadPlugin(*AssemblyPath, bisCollectible);
+	FileHash = ComputeFileHash();
+
+	// The modules run user code, they are started by FinishLoadingAssembly on the game thread.
+	FGCHandle NewHandle = UCSManager::Get().GetManagedPluginsCallbacks().LoadPlugin(*AssemblyPath, bIsCollectible, false);
 	NewHandle.Type = GCHandleType::WeakHandle;
 
 	if (NewHandle.IsNull())
@@ -60,139 +75,449 @@ bool UCSAssembly::LoadAssembly(bool bisCollectible)
 	}
 	
 	ManagedAssemblyHandle = MakeShared<FGCHandle>(NewHandle);
+	bHasTypeMetadata = ParseTypeMetadata();
+
+	if (ParsedTypeMetadata.IsValid())
+	{
+		// One call for all types, instead of one lookup per type while the types are built.
+		ResolveTypeHandles();
+	}
+
+	return true;
+}
+
+bool UCSAssembly::FinishLoadingAssembly()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(TEXT("UCSAssembly::FinishLoadingAssembly: " + AssemblyName.ToString())));
+	check(IsInGameThread());
+
+	UCSManager& Manager = UCSManager::Get();
+	Manager.GetManagedPluginsCallbacks().StartPluginModules(*AssemblyPath);
 	FModuleManager::Get().OnModulesChanged().AddUObject(this, &UCSAssembly::OnModulesChanged);
 
-	if (ProcessTypeMetadata())
+	if (bHasTypeMetadata)
 	{
+		RegisterTypeMetadata();
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::StartBuildingManagedTypes);
+		
 		for (const TPair<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>>& NameToTypeInfo : AllTypes)
 		{
 			NameToTypeInfo.Value->StartBuildingManagedType();
 		}
 	}
 
+	bHasTypeMetadata = false;
 	bIsLoading = false;
-	UCSManager::Get().OnManagedAssemblyLoadedEvent().Broadcast(AssemblyName);
+	Manager.OnManagedAssemblyLoadedEvent().Broadcast(AssemblyName);
 	return true;
 }
 
+namespace
+{
+	// The part of a type's metadata that is read up front to decide if the type has to be parsed and rebuilt.
+	struct FCSMetaDataEntry
+	{
+		FCSFieldName FieldName;
+
+		// Hash of the type's metadata written by the weaver. Zero if the metadata was written without hashes.
+		uint64 ContentHash = 0;
+
+		// Types that this type references, e.g. its parent class and the types of its properties.
+		TArray<FCSFieldName> Dependencies;
+
+		bool bNeedsRebuild = false;
+	};
+
+	struct FCSMetaDataSectionBase
+	{
+		explicit FCSMetaDataSectionBase(const FCSMetaDataValue& InValues) : Values(InValues)
+		{
+			Entries.SetNum(Values.Num());
+
+			for (int32 Index = 0; Index < Values.Num(); ++Index)
+			{
+				const FCSMetaDataValue Object = Values[Index];
+				FCSMetaDataEntry& Entry = Entries[Index];
+				Entry.FieldName = FCSFieldName(*Object.GetStringField(TEXT("Name")), *Object.GetStringField(TEXT("Namespace")));
+
+				FString ContentHash;
+				if (Object.TryGetStringField(TEXT("ContentHash"), ContentHash))
+				{
+					Entry.ContentHash = FParse::HexNumber64(*ContentHash);
+				}
+
+				const FCSMetaDataValue Dependencies = Object.GetField(TEXT("Dependencies"));
+				Entry.Dependencies.Reserve(Dependencies.Num());
+				for (int32 DependencyIndex = 0; DependencyIndex < Dependencies.Num(); ++DependencyIndex)
+				{
+					const FCSMetaDataValue Dependency = Dependencies[DependencyIndex];
+					Entry.Dependencies.Emplace(*Dependency.GetStringField(TEXT("Name")), *Dependency.GetStringField(TEXT("Namespace")));
+				}
+			}
+		}
+
+		virtual ~FCSMetaDataSectionBase() = default;
+		virtual void Parse(int32 Index) = 0;
+
+		// Points into the metadata document, which is only loaded while ParseTypeMetadata runs.
+		FCSMetaDataValue Values;
+		TArray<FCSMetaDataEntry> Entries;
+	};
+
+	// Parsed metadata for one of the type arrays in the metadata file. Each entry is only written by the task that parses it.
+	template <typename MetaDataType>
+	struct TCSMetaDataSection : FCSMetaDataSectionBase
+	{
+		TCSMetaDataSection(const FCSMetaDataValue& Root, const TCHAR* FieldName) : FCSMetaDataSectionBase(Root.GetField(FieldName))
+		{
+			MetaData.SetNum(Values.Num());
+		}
+
+		virtual void Parse(int32 Index) override
+		{
+			TSharedPtr<MetaDataType> ParsedMeta = MakeShared<MetaDataType>();
+			ParsedMeta->Serialize(Values[Index]);
+			MetaData[Index] = MoveTemp(ParsedMeta);
+		}
+
+		TArray<TSharedPtr<MetaDataType>> MetaData;
+	};
+
+	// Flags the types whose content hash changed, and everything in the assembly that transitively depends on them.
+	void MarkTypesToRebuild(TConstArrayView<FCSMetaDataSectionBase*> Sections, const TMap<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>>& ExistingTypes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ParseTypeMetadata::MarkTypesToRebuild);
+
+		TMap<FCSFieldName, TArray<FCSMetaDataEntry*>> Dependents;
+		TArray<FCSMetaDataEntry*> ChangedEntries;
+
+		for (FCSMetaDataSectionBase* Section : Sections)
+		{
+			for (FCSMetaDataEntry& Entry : Section->Entries)
+			{
+				for (const FCSFieldName& Dependency : Entry.Dependencies)
+				{
+					Dependents.FindOrAdd(Dependency).Add(&Entry);
+				}
+
+				const TSharedPtr<FCSManagedTypeInfo>& ExistingType = ExistingTypes.FindRef(Entry.FieldName);
+				if (!ExistingType.IsValid()
+					|| ExistingType->GetStructureState() == HasChangedStructure
+					|| Entry.ContentHash == 0
+					|| ExistingType->GetContentHash() != Entry.ContentHash)
+				{
+					Entry.bNeedsRebuild = true;
+					ChangedEntries.Add(&Entry);
+				}
+			}
+		}
+
+		while (!ChangedEntries.IsEmpty())
+		{
+			const FCSMetaDataEntry* ChangedEntry = ChangedEntries.Pop();
+
+			const TArray<FCSMetaDataEntry*>* FoundDependents = Dependents.Find(ChangedEntry->FieldName);
+			if (FoundDependents == nullptr)
+			{
+				continue;
+			}
+
+			for (FCSMetaDataEntry* Dependent : *FoundDependents)
+			{
+				if (!Dependent->bNeedsRebuild)
+				{
+					Dependent->bNeedsRebuild = true;
+					ChangedEntries.Add(Dependent);
+				}
+			}
+		}
+	}
+
+	// Parses the types that need a rebuild on the task graph. The parsing only reads the metadata document and writes the new metadata.
+	void ParseMetaDataSections(TConstArrayView<FCSMetaDataSectionBase*> Sections)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ParseTypeMetadata::Parse);
+
+		TArray<TPair<FCSMetaDataSectionBase*, int32>> EntriesToParse;
+		for (FCSMetaDataSectionBase* Section : Sections)
+		{
+			for (int32 Index = 0; Index < Section->Entries.Num(); ++Index)
+			{
+				if (Section->Entries[Index].bNeedsRebuild)
+				{
+					EntriesToParse.Emplace(Section, Index);
+				}
+			}
+		}
+
+		ParallelFor(EntriesToParse.Num(), [&EntriesToParse](int32 Index)
+		{
+			const TPair<FCSMetaDataSectionBase*, int32>& EntryToParse = EntriesToParse[Index];
+			EntryToParse.Key->Parse(EntryToParse.Value);
+		});
+	}
+}
+
+// The metadata sections of an assembly, parsed by LoadManagedAssembly and registered later on the game thread.
+struct FCSParsedTypeMetadata
+{
+	explicit FCSParsedTypeMetadata(const FCSMetaDataValue& Root)
+		: StructMetaData(Root, TEXT("StructMetaData"))
+		, EnumMetaData(Root, TEXT("EnumMetaData"))
+		, InterfacesMetaData(Root, TEXT("InterfacesMetaData"))
+		, DelegatesMetaData(Root, TEXT("DelegateMetaData"))
+		, ClassesMetaData(Root, TEXT("ClassMetaData"))
+	{
+	}
+
+	TArray<FCSMetaDataSectionBase*, TFixedAllocator<5>> GetSections()
+	{
+		return { &StructMetaData, &EnumMetaData, &InterfacesMetaData, &DelegatesMetaData, &ClassesMetaData };
+	}
+
+	TCSMetaDataSection<FCSStructMetaData> StructMetaData;
+	TCSMetaDataSection<FCSEnumMetaData> EnumMetaData;
+	TCSMetaDataSection<FCSInterfaceMetaData> InterfacesMetaData;
+	TCSMetaDataSection<FCSDelegateMetaData> DelegatesMetaData;
+	TCSMetaDataSection<FCSClassMetaData> ClassesMetaData;
+};
+
 template <typename T, typename MetaDataType>
-void RegisterMetaData(UCSAssembly* OwningAssembly, const TSharedPtr<FJsonValue>& MetaData,
+void RegisterMetaData(UCSAssembly* OwningAssembly, const TCSMetaDataSection<MetaDataType>& Section,
 	TMap<FCSFieldName,
 	TSharedPtr<FCSManagedTypeInfo>>& Map,
 	UClass* FieldType,
 	TFunction<void(TSharedPtr<FCSManagedTypeInfo>)> OnRebuild = nullptr)
 {
-	const TSharedPtr<FJsonObject>& MetaDataObject = MetaData->AsObject();
-
-	const FString Name= MetaDataObject->GetStringField(TEXT("Name"));
-	const FString Namespace = MetaDataObject->GetStringField(TEXT("Namespace"));
-	const FCSFieldName FullName(*Name, *Namespace);
-
-	TSharedPtr<FCSManagedTypeInfo> ExistingValue = Map.FindRef(FullName);
-
-	if (ExistingValue.IsValid())
+	for (int32 Index = 0; Index < Section.Entries.Num(); ++Index)
 	{
-		// Parse fresh metadata and update the existing info
-		MetaDataType NewMeta;
-		NewMeta.SerializeFromJson(MetaDataObject);
+		const FCSMetaDataEntry& Entry = Section.Entries[Index];
+		if (!Entry.bNeedsRebuild)
+		{
+			// Same content hash and no changed dependencies, the existing type info is kept as is.
+			continue;
+		}
+
+		const TSharedPtr<MetaDataType>& ParsedMeta = Section.MetaData[Index];
+		TSharedPtr<FCSManagedTypeInfo> ExistingValue = Map.FindRef(Entry.FieldName);
 
-		if (ExistingValue->GetStructureState() == HasChangedStructure || NewMeta != *ExistingValue->GetTypeMetaData<MetaDataType>())
+		if (ExistingValue.IsValid())
 		{
-			TSharedPtr<MetaDataType> MetaDataPtr = MakeShared<MetaDataType>(NewMeta);
-			ExistingValue->SetTypeMetaData(MetaDataPtr);
-			ExistingValue->SetStructureState(HasChangedStructure);
-			
-			if (OnRebuild)
+			// With a content hash the type is known to be changed at this point. Without one, fall back to comparing the metadata.
+			if (ExistingValue->GetStructureState() == HasChangedStructure || Entry.ContentHash != 0 || *ParsedMeta != *ExistingValue->GetTypeMetaData<MetaDataType>())
 			{
-				OnRebuild(ExistingValue);
+				ExistingValue->SetTypeMetaData(ParsedMeta);
+				ExistingValue->SetStructureState(HasChangedStructure);
+				
+				if (OnRebuild)
+				{
+					OnRebuild(ExistingValue);
+				}
 			}
+
+			ExistingValue->SetContentHash(Entry.ContentHash);
+		}
+		else
+		{
+			TSharedPtr<T> NewValue = MakeShared<T>(ParsedMeta, OwningAssembly, FieldType);
+			NewValue->SetContentHash(Entry.ContentHash);
+			Map.Add(Entry.FieldName, NewValue);
 		}
 	}
-	else
+}
+
+uint64 UCSAssembly::ComputeFileHash() const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ComputeFileHash);
+
+	const FString FilePaths[] =
 	{
-		TSharedPtr<MetaDataType> ParsedMeta = MakeShared<MetaDataType>();
-		ParsedMeta->SerializeFromJson(MetaDataObject);
-		
-		TSharedPtr<T> NewValue = MakeShared<T>(ParsedMeta, OwningAssembly, FieldType);
-		Map.Add(FullName, NewValue);
+		AssemblyPath,
+		FPaths::ChangeExtension(AssemblyPath, "metadata.json"),
+		FPaths::ChangeExtension(AssemblyPath, "metadata.bin"),
+	};
+
+	FXxHash64Builder Builder;
+	TArray<uint8> FileData;
+
+	for (const FString& FilePath : FilePaths)
+	{
+		FileData.Reset();
+		FFileHelper::LoadFileToArray(FileData, *FilePath, FILEREAD_Silent);
+
+		// The size separates the files, and tells a missing file apart from an empty one.
+		const int64 FileSize = IFileManager::Get().FileSize(*FilePath);
+		Builder.Update(&FileSize, sizeof(FileSize));
+		Builder.Update(FileData.GetData(), FileData.Num());
 	}
+
+	return Builder.Finalize().Hash;
 }
 
-bool UCSAssembly::ProcessTypeMetadata()
-{
-	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ProcessTypeMetadata);
+static TAutoConsoleVariable<bool> CVarPreferBinaryMetadata(
+	TEXT("UnrealSharp.PreferBinaryMetadata"),
+	true,
+	TEXT("Read the type metadata of user assemblies from <Assembly>.metadata.bin when it's up to date. Disable to read <Assembly>.metadata.json instead, e.g. to compare load times."));
 
+bool UCSAssembly::LoadTypeMetadata(FCSMetaDataDocument& OutDocument) const
+{
 	const FString MetadataPath = FPaths::ChangeExtension(AssemblyPath, "metadata.json");
-	if (!FPaths::FileExists(MetadataPath))
+	const FString BinaryMetadataPath = FPaths::ChangeExtension(AssemblyPath, "metadata.bin");
+
+	IFileManager& FileManager = IFileManager::Get();
+	const FDateTime MetadataTimeStamp = FileManager.GetTimeStamp(*MetadataPath);
+	const FDateTime BinaryMetadataTimeStamp = FileManager.GetTimeStamp(*BinaryMetadataPath);
+	const bool bHasJsonMetadata = MetadataTimeStamp != FDateTime::MinValue();
+
+	// Prefer the binary metadata, unless it's missing or older than the JSON (e.g. written by an older weaver).
+	const bool bPreferBinary = CVarPreferBinaryMetadata.GetValueOnAnyThread() || !bHasJsonMetadata;
+	if (bPreferBinary && BinaryMetadataTimeStamp != FDateTime::MinValue() && BinaryMetadataTimeStamp >= MetadataTimeStamp)
 	{
-		return true;
+		if (OutDocument.LoadBinaryFile(BinaryMetadataPath))
+		{
+			return true;
+		}
+
+		UE_LOGFMT(LogUnrealSharp, Warning, "Failed to read binary metadata at: {0}. Falling back to JSON.", *BinaryMetadataPath);
 	}
 
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *MetadataPath))
+	if (!OutDocument.LoadJsonFile(MetadataPath))
 	{
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to load MetaDataPath at: %s"), *MetadataPath);
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonObject;
-	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject.IsValid())
+	return true;
+}
+
+bool UCSAssembly::ParseTypeMetadata()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ParseTypeMetadata);
+
+	if (!FPaths::FileExists(FPaths::ChangeExtension(AssemblyPath, "metadata.json"))
+		&& !FPaths::FileExists(FPaths::ChangeExtension(AssemblyPath, "metadata.bin")))
 	{
-		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to parse JSON at: %s"), *MetadataPath);
-		return false;
+		return true;
 	}
-	
-	UCSManager& Manager = UCSManager::Get();
 
-	const TArray<TSharedPtr<FJsonValue>>& StructMetaData = JsonObject->GetArrayField(TEXT("StructMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : StructMetaData)
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Only needed while parsing, so a mapped binary file is released before the types are registered.
+	FCSMetaDataDocument Document;
 	{
-		RegisterMetaData<FCSManagedTypeInfo, FCSStructMetaData>(this, MetaData, AllTypes, UCSScriptStruct::StaticClass());
+		TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ParseTypeMetadata::Load);
+		if (!LoadTypeMetadata(Document))
+		{
+			return false;
+		}
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>& EnumMetaData = JsonObject->GetArrayField(TEXT("EnumMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : EnumMetaData)
+	ParsedTypeMetadata = MakeShared<FCSParsedTypeMetadata>(Document.GetRoot());
+
+	TArray<FCSMetaDataSectionBase*, TFixedAllocator<5>> Sections = ParsedTypeMetadata->GetSections();
+	MarkTypesToRebuild(Sections, AllTypes);
+	ParseMetaDataSections(Sections);
+
+	UE_LOGFMT(LogUnrealSharp, Log, "Parsed {0} metadata of {1} in {2} ms.", Document.IsBinary() ? TEXT("binary") : TEXT("JSON"), AssemblyName, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	return true;
+}
+
+void UCSAssembly::ResolveTypeHandles()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::ResolveTypeHandles);
+
+	TArray<FCSFieldName> FieldNames;
+	for (const FCSMetaDataSectionBase* Section : ParsedTypeMetadata->GetSections())
 	{
-		RegisterMetaData<FCSManagedTypeInfo, FCSEnumMetaData>(this, MetaData, AllTypes, UCSEnum::StaticClass());
+		for (const FCSMetaDataEntry& Entry : Section->Entries)
+		{
+			if (!ManagedClassHandles.Contains(Entry.FieldName))
+			{
+				FieldNames.Add(Entry.FieldName);
+			}
+		}
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>& InterfacesMetaData = JsonObject->GetArrayField(TEXT("InterfacesMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : InterfacesMetaData)
+	if (FieldNames.IsEmpty())
 	{
-		RegisterMetaData<FCSManagedTypeInfo, FCSInterfaceMetaData>(this, MetaData, AllTypes, UCSInterface::StaticClass());
+		return;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>& DelegatesMetaData = JsonObject->GetArrayField(TEXT("DelegateMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : DelegatesMetaData)
+	TArray<FString> FullNames;
+	TArray<const TCHAR*> FullNamePointers;
+	FullNames.Reserve(FieldNames.Num());
+	FullNamePointers.Reserve(FieldNames.Num());
+
+	for (const FCSFieldName& FieldName : FieldNames)
 	{
-		RegisterMetaData<FCSManagedTypeInfo, FCSDelegateMetaData>(this, MetaData, AllTypes, UDelegateFunction::StaticClass());
+		FullNamePointers.Add(*FullNames.Add_GetRef(FieldName.GetFullName().ToString()));
+	}
+
+	TArray<uint8*> TypeHandles;
+	TypeHandles.SetNumZeroed(FieldNames.Num());
+	FCSManagedCallbacks::ManagedCallbacks.LookupManagedTypes(ManagedAssemblyHandle->GetPointer(), FullNamePointers.GetData(), FieldNames.Num(), TypeHandles.GetData());
+
+	for (int32 Index = 0; Index < FieldNames.Num(); ++Index)
+	{
+		if (TypeHandles[Index] == nullptr)
+		{
+			continue;
+		}
+
+		TSharedPtr<FGCHandle> AllocatedHandle = MakeShared<FGCHandle>(TypeHandles[Index], GCHandleType::WeakHandle);
+		AllocatedManagedHandles.Add(AllocatedHandle);
+		ManagedClassHandles.Add(FieldNames[Index], AllocatedHandle);
 	}
+}
 
-	const TArray<TSharedPtr<FJsonValue>>& ClassesMetaData = JsonObject->GetArrayField(TEXT("ClassMetaData"));
-	for (const TSharedPtr<FJsonValue>& MetaData : ClassesMetaData)
+void UCSAssembly::RegisterTypeMetadata()
+{
+	if (!ParsedTypeMetadata.IsValid())
 	{
-		RegisterMetaData<FCSClassInfo, FCSClassMetaData>(this, MetaData, AllTypes, UCSClass::StaticClass(),
-         [&Manager](const TSharedPtr<FCSManagedTypeInfo>& ClassInfo)
-         {
-             // Structure has been changed. We must trigger full reload on all managed classes that derive from this class.
-             TArray<UClass*> DerivedClasses;
-             GetDerivedClasses(ClassInfo->GetFieldChecked<UClass>(), DerivedClasses);
+		return;
+	}
+
+	// Merging into AllTypes touches UObjects and the existing type infos, so it stays on the game thread.
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::RegisterTypeMetadata);
+
+	TSharedPtr<FCSParsedTypeMetadata> TypeMetadata = MoveTemp(ParsedTypeMetadata);
+	UCSManager& Manager = UCSManager::Get();
+
+	RegisterMetaData<FCSManagedTypeInfo>(this, TypeMetadata->StructMetaData, AllTypes, UCSScriptStruct::StaticClass());
+	RegisterMetaData<FCSManagedTypeInfo>(this, TypeMetadata->EnumMetaData, AllTypes, UCSEnum::StaticClass());
+	RegisterMetaData<FCSManagedTypeInfo>(this, TypeMetadata->InterfacesMetaData, AllTypes, UCSInterface::StaticClass());
+	RegisterMetaData<FCSManagedTypeInfo>(this, TypeMetadata->DelegatesMetaData, AllTypes, UDelegateFunction::StaticClass());
+	RegisterMetaData<FCSClassInfo>(this, TypeMetadata->ClassesMetaData, AllTypes, UCSClass::StaticClass(),
+		[&Manager](const TSharedPtr<FCSManagedTypeInfo>& ClassInfo)
+		{
+			// Structure has been changed. We must trigger full reload on all managed classes that derive from this class.
+			TArray<UClass*> DerivedClasses;
+			GetDerivedClasses(ClassInfo->GetFieldChecked<UClass>(), DerivedClasses);
 
-             for (UClass* DerivedClass : DerivedClasses)
-             {
-                 if (!Manager.IsManagedType(DerivedClass))
-                 {
-                     continue;
-                 }
+			for (UClass* DerivedClass : DerivedClasses)
+			{
+				if (!Manager.IsManagedType(DerivedClass))
+				{
+					continue;
+				}
+
+				UCSClass* ManagedClass = static_cast<UCSClass*>(DerivedClass);
+				TSharedPtr<FCSClassInfo> ChildClassInfo = ManagedClass->GetManagedTypeInfo<FCSClassInfo>();
+				ChildClassInfo->SetStructureState(HasChangedStructure);
+			}
+		});
 
-                 UCSClass* ManagedClass = static_cast<UCSClass*>(DerivedClass);
-                 TSharedPtr<FCSClassInfo> ChildClassInfo = ManagedClass->GetManagedTypeInfo<FCSClassInfo>();
-                 ChildClassInfo->SetStructureState(HasChangedStructure);
-             }
-         });
+	int32 NumTypesToRebuild = 0;
+	for (const TPair<FCSFieldName, TSharedPtr<FCSManagedTypeInfo>>& NameToTypeInfo : AllTypes)
+	{
+		if (NameToTypeInfo.Value->GetStructureState() == HasChangedStructure)
+		{
+			++NumTypesToRebuild;
+		}
 	}
 
-	return true;
+	UE_LOGFMT(LogUnrealSharp, Display, "{0}: Rebuilding {1} of {2} types.", *AssemblyName.ToString(), NumTypesToRebuild, AllTypes.Num());
 }
 
 bool UCSAssembly::UnloadAssembly()
@@ -206,7 +531,15 @@ bool UCSAssembly::UnloadAssembly()
 
 	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(TEXT("UCSAssembly::UnloadAssembly: " + AssemblyName.ToString())));
 
+	UCSManager& Manager = UCSManager::Get();
+	
+	// Handles queued during the last GC must be freed before the assembly goes away.
+	Manager.FlushPendingHandleDisposals();
+
 	FGCHandleIntPtr AssemblyHandle = ManagedAssemblyHandle->GetHandle();
+	ManagedObjectPool.DisposeAll(AssemblyHandle);
+	Manager.ManagedObjectHandles.DisposeAllOwnedBy(this, AssemblyHandle);
+
 	for (TSharedPtr<FGCHandle>& Handle : AllocatedManagedHandles)
 	{
 		Handle->Dispose(AssemblyHandle);
@@ -271,12 +604,22 @@ TSharedPtr<FGCHandle> UCSAssembly::GetManagedMethod(const TSharedPtr<FGCHandle>&
 	return AllocatedHandle;
 }
 
-TSharedPtr<FGCHandle> UCSAssembly::CreateManagedObject(const UObject* Object)
+FGCHandle UCSAssembly::CreateManagedObject(const UObject* Object)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSAssembly::CreateManagedObject);
 	
 	// Only managed/native classes have a C# counterpart.
 	UClass* Class = FCSClassUtilities::GetFirstNonBlueprintClass(Object->GetClass());
+
+	FGCHandle PooledManagedObject;
+	if (FCSClassUtilities::IsManagedClass(Class)
+		&& static_cast<UCSClass*>(Class)->GetManagedObjectPoolSize() > 0
+		&& ManagedObjectPool.TryAcquire(Class, Object, PooledManagedObject))
+	{
+		UCSManager::Get().ManagedObjectHandles.Add(Object, PooledManagedObject, this);
+		return PooledManagedObject;
+	}
+
 	TSharedPtr<FCSManagedTypeInfo> TypeInfo = FindOrAddTypeInfo(Class);
 	TSharedPtr<FGCHandle> TypeHandle = TypeInfo->GetManagedTypeHandle();
 
@@ -288,16 +631,11 @@ TSharedPtr<FGCHandle> UCSAssembly::CreateManagedObject(const UObject* Object)
 	{
 		// This should never happen. Potential issues: IL errors, typehandle is invalid.
 		UE_LOGFMT(LogUnrealSharp, Fatal, "Failed to create managed counterpart for {0}:\n{1}", *Object->GetName(), Error);
-		return nullptr;
+		return FGCHandle::Null();
 	}
 
-	TSharedPtr<FGCHandle> Handle = MakeShared<FGCHandle>(NewManagedObject);
-	AllocatedManagedHandles.Add(Handle);
-
-	uint32 ObjectID = Object->GetUniqueID();
-	UCSManager::Get().ManagedObjectHandles.AddByHash(ObjectID, ObjectID, Handle);
-
-	return Handle;
+	UCSManager::Get().ManagedObjectHandles.Add(Object, NewManagedObject, this);
+	return NewManagedObject;
 }
 
 TSharedPtr<FGCHandle> UCSAssembly::FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass)
@@ -317,13 +655,13 @@ TSharedPtr<FGCHandle> UCSAssembly::FindOrCreateManagedInterfaceWrapper(UObject*
 		return *Existing;
 	}
 
-    TSharedPtr<FGCHandle>* ObjectHandle = UCSManager::Get().ManagedObjectHandles.FindByHash(ObjectID, ObjectID);
-	if (ObjectHandle == nullptr)
+	const FCSManagedObjectHandleEntry* ObjectEntry = UCSManager::Get().ManagedObjectHandles.Find(Object);
+	if (ObjectEntry == nullptr)
 	{
 		return nullptr;
 	}
     
-	FGCHandle NewManagedObjectWrapper = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObjectWrapper((*ObjectHandle)->GetPointer(), TypeHandle->GetPointer());
+	FGCHandle NewManagedObjectWrapper = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObjectWrapper(ObjectEntry->Handle.GetPointer(), TypeHandle->GetPointer());
 	NewManagedObjectWrapper.Type = GCHandleType::StrongHandle;
 
 	if (NewManagedObjectWrapper.IsNull())
@@ -340,6 +678,29 @@ TSharedPtr<FGCHandle> UCSAssembly::FindOrCreateManagedInterfaceWrapper(UObject*
 	return Handle;
 }
 
+bool UCSAssembly::TryReleaseManagedObjectToPool(const UObjectBase* Object, FGCHandle& Handle)
+{
+	UClass* Class = FCSClassUtilities::GetFirstNonBlueprintClass(Object->GetClass());
+
+	if (!FCSClassUtilities::IsManagedClass(Class))
+	{
+		return false;
+	}
+
+	const int32 PoolSize = static_cast<UCSClass*>(Class)->GetManagedObjectPoolSize();
+	return PoolSize > 0 && ManagedObjectPool.QueueRelease(Class, PoolSize, Handle);
+}
+
+void UCSAssembly::FlushManagedObjectPool()
+{
+	if (!IsValidAssembly())
+	{
+		return;
+	}
+
+	ManagedObjectPool.FlushPendingReleases(ManagedAssemblyHandle->GetHandle());
+}
+
 void UCSAssembly::AddPendingClass(const FCSTypeReferenceMetaData& ParentClass, FCSClassInfo* NewClass)
 {
 	TSet<FCSClassInfo*>& PendingClass = PendingClasses.FindOrAdd(ParentClass);
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "CSManagedGCHandle.h"
+#include "CSManagedObjectPool.h"
 #include "UnrealSharpCore.h"
 #include "Logging/StructuredLog.h"
 #include "TypeGenerator/Register/MetaData/CSTypeReferenceMetaData.h"
@@ -14,6 +15,8 @@
 struct FCSClassInfo;
 struct FCSManagedMethod;
 class UCSClass;
+class FCSMetaDataDocument;
+struct FCSParsedTypeMetadata;
 
 /**
  * Represents a managed assembly.
@@ -27,12 +30,25 @@ public:
 	void SetAssemblyPath(const FStringView InAssemblyPath);
 
 	UNREALSHARPCORE_API bool LoadAssembly(bool bIsCollectible = true);
+
+	// First half of LoadAssembly: loads the managed assembly and parses its type metadata. Doesn't touch any UObjects, so it can run on any thread.
+	bool LoadManagedAssembly(bool bIsCollectible = true);
+
+	// Second half of LoadAssembly: starts the managed modules and builds the types. Game thread only.
+	bool FinishLoadingAssembly();
+
 	UNREALSHARPCORE_API bool UnloadAssembly();
 	UNREALSHARPCORE_API bool IsValidAssembly() const { return ManagedAssemblyHandle.IsValid() && !ManagedAssemblyHandle->IsNull(); }
 
 	FName GetAssemblyName() const { return AssemblyName; }
 	const FString& GetAssemblyPath() const { return AssemblyPath; }
 
+	// Hash of the assembly and its metadata files as they were when the assembly was loaded.
+	uint64 GetFileHash() const { return FileHash; }
+
+	// Hashes the assembly and its metadata files as they are on disk now.
+	UNREALSHARPCORE_API uint64 ComputeFileHash() const;
+
 	bool IsLoading() const { return bIsLoading; }
 
 	TSharedPtr<FGCHandle> TryFindTypeHandle(const FCSFieldName& FieldName);
@@ -112,9 +128,14 @@ public:
 	}
 
 	// Creates a C# counterpart for the given UObject.
-	TSharedPtr<FGCHandle> CreateManagedObject(const UObject* Object);
+	FGCHandle CreateManagedObject(const UObject* Object);
 	TSharedPtr<FGCHandle> FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass);
 
+	// Keeps the C# counterpart of a destroyed object for reuse if its class is pooled. Can be called from any thread.
+	// Returns false if the handle should be disposed as usual.
+	bool TryReleaseManagedObjectToPool(const UObjectBase* Object, FGCHandle& Handle);
+	void FlushManagedObjectPool();
+
 	// Add a class that is waiting for its parent class to be loaded before it can be created.
 	void AddPendingClass(const FCSTypeReferenceMetaData& ParentClass, FCSClassInfo* NewClass);
 
@@ -122,7 +143,10 @@ public:
 
 private:
 	
-	bool ProcessTypeMetadata();
+	bool ParseTypeMetadata();
+	void RegisterTypeMetadata();
+	void ResolveTypeHandles();
+	bool LoadTypeMetadata(FCSMetaDataDocument& OutDocument) const;
 
 	void OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason);
 
@@ -160,6 +184,9 @@ private:
 	// Pending classes that are waiting for their parent class to be loaded by the engine.
 	TMap<FCSTypeReferenceMetaData, TSet<FCSClassInfo*>> PendingClasses;
 
+	// C# counterparts of destroyed objects of pooled classes, waiting to be reused.
+	FCSManagedObjectPool ManagedObjectPool;
+
 	// Handle to the Assembly object in C#.
 	TSharedPtr<FGCHandle> ManagedAssemblyHandle;
 
@@ -169,5 +196,11 @@ private:
 	// Assembly file name without the path.
 	FName AssemblyName;
 
+	uint64 FileHash = 0;
+
+	// Metadata parsed by LoadManagedAssembly, registered and released by FinishLoadingAssembly.
+	TSharedPtr<FCSParsedTypeMetadata> ParsedTypeMetadata;
+	bool bHasTypeMetadata = false;
+
 	bool bIsLoading = false;
 };
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "CSGameThreadDispatchQueue.h"
+#include "CSManager.h"
+#include "UnrealSharpCore.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Game Thread Continuations"), STAT_UnrealSharp_GameThreadContinuations, STATGROUP_UnrealSharp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Game Thread Continuations"), STAT_UnrealSharp_DeferredGameThreadContinuations, STATGROUP_UnrealSharp);
+
+void FCSGameThreadDispatchQueue::Enqueue(const TWeakObjectPtr<UObject>& WorldContextObject, FGCHandleIntPtr DelegateHandle)
+{
+	PendingContinuations.Enqueue(FPendingContinuation { WorldContextObject, DelegateHandle });
+	NumPending.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FCSGameThreadDispatchQueue::Drain(double BudgetSeconds)
+{
+	check(IsInGameThread());
+
+	if (Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSGameThreadDispatchQueue::Drain);
+
+	UCSManager& Manager = UCSManager::Get();
+	const double EndTime = FPlatformTime::Seconds() + BudgetSeconds;
+
+	TArray<FGCHandleIntPtr, TInlineAllocator<MaxBatchSize>> Batch;
+	TArray<FGCHandleIntPtr> StaleHandles;
+	TWeakObjectPtr<UObject> BatchWorldContext;
+	int32 NumInvoked = 0;
+
+	auto InvokeBatch = [&]()
+	{
+		if (Batch.IsEmpty())
+		{
+			return;
+		}
+
+		Manager.SetCurrentWorldContext(BatchWorldContext.Get());
+		FCSManagedCallbacks::ManagedCallbacks.InvokeDelegateBatch(Batch.GetData(), Batch.Num());
+
+		NumInvoked += Batch.Num();
+		Batch.Reset();
+	};
+
+	int32 NumDequeued;
+	do
+	{
+		NumDequeued = 0;
+
+		// Continuations enqueued while the batch runs (e.g. an await resuming on the game thread) are picked up by the next batch.
+		FPendingContinuation Continuation;
+		while (NumDequeued < MaxBatchSize && PendingContinuations.Dequeue(Continuation))
+		{
+			++NumDequeued;
+
+			if (!Continuation.WorldContextObject.IsValid())
+			{
+				StaleHandles.Add(Continuation.DelegateHandle);
+				continue;
+			}
+
+			// The world context is set once per batch, so a batch only contains continuations for the same world.
+			if (!Batch.IsEmpty() && BatchWorldContext != Continuation.WorldContextObject)
+			{
+				InvokeBatch();
+			}
+
+			BatchWorldContext = Continuation.WorldContextObject;
+			Batch.Add(Continuation.DelegateHandle);
+		}
+
+		NumPending.fetch_sub(NumDequeued, std::memory_order_relaxed);
+		InvokeBatch();
+	}
+	while (NumDequeued == MaxBatchSize && FPlatformTime::Seconds() < EndTime);
+
+	FGCHandle::DisposeBatch(StaleHandles.GetData(), StaleHandles.Num());
+
+	SET_DWORD_STAT(STAT_UnrealSharp_GameThreadContinuations, NumInvoked);
+	SET_DWORD_STAT(STAT_UnrealSharp_DeferredGameThreadContinuations, Num());
+}
+
+void FCSGameThreadDispatchQueue::DisposeAll()
+{
+	TArray<FGCHandleIntPtr> Handles;
+	
+	FPendingContinuation Continuation;
+	while (PendingContinuations.Dequeue(Continuation))
+	{
+		Handles.Add(Continuation.DelegateHandle);
+	}
+
+	NumPending.fetch_sub(Handles.Num(), std::memory_order_relaxed);
+	FGCHandle::DisposeBatch(Handles.GetData(), Handles.Num());
+}
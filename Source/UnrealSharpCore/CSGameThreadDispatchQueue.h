@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSManagedGCHandle.h"
+#include "Containers/MpscQueue.h"
+
+/**
+ * Lock-free queue of managed continuations that have to run on the game thread, e.g. C# awaits resuming through RunOnThread.
+ * Any thread can enqueue. The game thread drains the queue once per tick and invokes the delegates in batches,
+ * with one managed call per batch instead of one task and one managed call per continuation.
+ */
+class FCSGameThreadDispatchQueue
+{
+public:
+
+	// Max number of delegates that are passed to C# in a single call.
+	static constexpr int32 MaxBatchSize = 256;
+
+	void Enqueue(const TWeakObjectPtr<UObject>& WorldContextObject, FGCHandleIntPtr DelegateHandle);
+
+	// Invokes queued continuations until the queue is empty or the budget is spent. What's left runs on the next drain.
+	// At least one batch is always invoked, so the queue keeps moving even with a zero budget.
+	void Drain(double BudgetSeconds);
+
+	// Frees all queued delegates without invoking them.
+	void DisposeAll();
+
+	int32 Num() const { return NumPending.load(std::memory_order_relaxed); }
+
+private:
+
+	struct FPendingContinuation
+	{
+		TWeakObjectPtr<UObject> WorldContextObject;
+		FGCHandleIntPtr DelegateHandle;
+	};
+
+	TMpscQueue<FPendingContinuation> PendingContinuations;
+	std::atomic<int32> NumPending = 0;
+};
@@ -23,6 +23,12 @@ class UNREALSHARPCORE_API FCSManagedCallbacks
 		using ManagedCallbacks_LookupType = uint8*(__stdcall*)(uint8*, const TCHAR*);
 		using ManagedCallbacks_Dispose = void(__stdcall*)(FGCHandleIntPtr, FGCHandleIntPtr);
 		using ManagedCallbacks_FreeHandle = void(__stdcall*)(FGCHandleIntPtr);
+		using ManagedCallbacks_DisposeBatch = void(__stdcall*)(FGCHandleIntPtr*, int32, FGCHandleIntPtr);
+		using ManagedCallbacks_InvokeDelegateBatch = void(__stdcall*)(FGCHandleIntPtr*, int32);
+		using ManagedCallbacks_ResetManagedObjectBatch = void(__stdcall*)(FGCHandleIntPtr*, int32, FGCHandleIntPtr);
+		using ManagedCallbacks_RebindManagedObject = int(__stdcall*)(FGCHandleIntPtr, const void*);
+		using ManagedCallbacks_LookupTypes = void(__stdcall*)(uint8*, const TCHAR**, int32, uint8**);
+		using ManagedCallbacks_InvalidateManagedObjectBatch = void(__stdcall*)(FGCHandleIntPtr*, int32);
 		
 		ManagedCallbacks_CreateNewManagedObject CreateNewManagedObject;
 		ManagedCallbacks_CreateNewManagedObjectWrapper CreateNewManagedObjectWrapper;
@@ -31,12 +37,27 @@ class UNREALSHARPCORE_API FCSManagedCallbacks
 		ManagedCallbacks_LookupMethod LookupManagedMethod;
 		ManagedCallbacks_LookupType LookupManagedType;
 
+		// Invokes and frees a batch of strong delegate handles.
+		ManagedCallbacks_InvokeDelegateBatch InvokeDelegateBatch;
+
+		// Used by FCSManagedObjectPool to reset released C# objects and bind them to new UObjects.
+		ManagedCallbacks_ResetManagedObjectBatch ResetManagedObjectBatch;
+		ManagedCallbacks_RebindManagedObject RebindManagedObject;
+
+		// Resolves the handles of many types of an assembly in one call. Types that aren't found get a null handle.
+		ManagedCallbacks_LookupTypes LookupManagedTypes;
+
+		// Clears the native object of the C# objects of UObjects that are about to be purged. The handles themselves are freed later.
+		ManagedCallbacks_InvalidateManagedObjectBatch InvalidateManagedObjectBatch;
+
 	private:
+		// Kept at the end of the struct, the field order has to match ManagedCallbacks.cs.
 		//Only call these from GCHandles.
 		friend FGCHandle;
 	    friend FScopedGCHandle;
 		ManagedCallbacks_Dispose Dispose;
 		ManagedCallbacks_FreeHandle FreeHandle;
+		ManagedCallbacks_DisposeBatch DisposeBatch;
 	};
 	
 	static inline FManagedCallbacks ManagedCallbacks;
@@ -54,6 +54,17 @@ struct FGCHandle
 		Type = GCHandleType::Null;
 	}
 
+	// Disposes many handles owned by the same assembly in a single managed call.
+	static void DisposeBatch(FGCHandleIntPtr* Handles, int32 NumHandles, FGCHandleIntPtr AssemblyHandle = FGCHandleIntPtr())
+	{
+		if (NumHandles <= 0)
+		{
+			return;
+		}
+
+		FCSManagedCallbacks::ManagedCallbacks.DisposeBatch(Handles, NumHandles, AssemblyHandle);
+	}
+
 	void operator = (const FGCHandle& Other)
 	{
 		Handle = Other.Handle;
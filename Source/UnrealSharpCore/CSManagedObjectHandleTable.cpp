@@ -0,0 +1,87 @@
+#include "CSManagedObjectHandleTable.h"
+
+void FCSManagedObjectHandleTable::Add(const UObjectBase* Object, const FGCHandle& Handle, UCSAssembly* OwningAssembly)
+{
+	const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+	check(ObjectIndex >= 0);
+
+	const int32 ChunkIndex = ObjectIndex / NumEntriesPerChunk;
+	if (ChunkIndex >= Chunks.Num())
+	{
+		Chunks.SetNum(ChunkIndex + 1);
+	}
+
+	TUniquePtr<FCSManagedObjectHandleEntry[]>& Chunk = Chunks[ChunkIndex];
+	if (!Chunk.IsValid())
+	{
+		Chunk = MakeUnique<FCSManagedObjectHandleEntry[]>(NumEntriesPerChunk);
+	}
+
+	FCSManagedObjectHandleEntry& Entry = Chunk[ObjectIndex % NumEntriesPerChunk];
+	if (Entry.IsEmpty())
+	{
+		++NumEntries;
+	}
+
+	Entry.Handle = Handle;
+	Entry.OwningAssembly = OwningAssembly;
+	Entry.SerialNumber = GUObjectArray.AllocateSerialNumber(ObjectIndex);
+}
+
+void FCSManagedObjectHandleTable::CollectUnreachableHandles(TArray<FGCHandleIntPtr>& OutHandles) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedObjectHandleTable::CollectUnreachableHandles);
+
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+	{
+		const TUniquePtr<FCSManagedObjectHandleEntry[]>& Chunk = Chunks[ChunkIndex];
+		if (!Chunk.IsValid())
+		{
+			continue;
+		}
+
+		for (int32 i = 0; i < NumEntriesPerChunk; ++i)
+		{
+			const FCSManagedObjectHandleEntry& Entry = Chunk[i];
+			if (Entry.IsEmpty())
+			{
+				continue;
+			}
+
+			// The object items outlive the objects, so this doesn't touch the memory of the UObjects.
+			const FUObjectItem* ObjectItem = GUObjectArray.IndexToObject(ChunkIndex * NumEntriesPerChunk + i);
+			if (ObjectItem != nullptr && ObjectItem->GetSerialNumber() == Entry.SerialNumber && ObjectItem->IsUnreachable())
+			{
+				OutHandles.Add(Entry.Handle.GetHandle());
+			}
+		}
+	}
+}
+
+void FCSManagedObjectHandleTable::DisposeAllOwnedBy(const UCSAssembly* Assembly, FGCHandleIntPtr AssemblyHandle)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedObjectHandleTable::DisposeAllOwnedBy);
+
+	for (TUniquePtr<FCSManagedObjectHandleEntry[]>& Chunk : Chunks)
+	{
+		if (!Chunk.IsValid())
+		{
+			continue;
+		}
+
+		for (int32 i = 0; i < NumEntriesPerChunk; ++i)
+		{
+			FCSManagedObjectHandleEntry& Entry = Chunk[i];
+			if (Entry.IsEmpty() || Entry.OwningAssembly != Assembly)
+			{
+				continue;
+			}
+
+			Entry.Handle.Dispose(AssemblyHandle);
+			Entry = FCSManagedObjectHandleEntry();
+			--NumEntries;
+		}
+	}
+
+	RemovalEpoch.fetch_add(1);
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CSManagedGCHandle.h"
+#include "UObject/UObjectArray.h"
+#include <atomic>
+
+class UCSAssembly;
+
+struct FCSManagedObjectHandleEntry
+{
+	// Handle to the C# counterpart of the UObject.
+	FGCHandle Handle;
+
+	// The assembly that created the C# counterpart. Needed to dispose the handle.
+	UCSAssembly* OwningAssembly = nullptr;
+
+	// Serial number of the UObject when the handle was added. Protects against stale entries for recycled indices.
+	int32 SerialNumber = 0;
+
+	bool IsEmpty() const { return Handle.IsNull(); }
+};
+
+/**
+ * Flat table of GC handles to the C# counterparts of UObjects, indexed directly by the GUObjectArray index.
+ * Entries are stored inline in fixed-size chunks that are allocated on demand, so lookups and removals are O(1)
+ * and don't require a heap allocation per object.
+ */
+class FCSManagedObjectHandleTable
+{
+public:
+
+	static constexpr int32 NumEntriesPerChunk = 16 * 1024;
+
+	FCSManagedObjectHandleEntry* Find(const UObjectBase* Object)
+	{
+		const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+		FCSManagedObjectHandleEntry* Entry = GetEntry(ObjectIndex);
+
+		if (Entry == nullptr || Entry->IsEmpty() || Entry->SerialNumber != GUObjectArray.IndexToObject(ObjectIndex)->GetSerialNumber())
+		{
+			return nullptr;
+		}
+
+		return Entry;
+	}
+
+	void Add(const UObjectBase* Object, const FGCHandle& Handle, UCSAssembly* OwningAssembly);
+
+	// Removes the entry at the given index. Returns false if there was no handle for the index.
+	bool RemoveAndCopyValue(int32 ObjectIndex, FCSManagedObjectHandleEntry& OutEntry)
+	{
+		FCSManagedObjectHandleEntry* Entry = GetEntry(ObjectIndex);
+
+		if (Entry == nullptr || Entry->IsEmpty())
+		{
+			return false;
+		}
+
+		OutEntry = *Entry;
+		*Entry = FCSManagedObjectHandleEntry();
+		--NumEntries;
+		RemovalEpoch.fetch_add(1);
+		return true;
+	}
+
+	// Collects the handles of the objects that the last reachability analysis found unreachable, i.e. that are freed by the upcoming purge.
+	void CollectUnreachableHandles(TArray<FGCHandleIntPtr>& OutHandles) const;
+
+	// Disposes and removes all handles that were created by the given assembly.
+	void DisposeAllOwnedBy(const UCSAssembly* Assembly, FGCHandleIntPtr AssemblyHandle);
+
+	int32 Num() const { return NumEntries; }
+
+	// Bumped every time handles are removed. C# caches UObject pointer lookups per epoch, so a freed and reused pointer is never resolved to a stale handle.
+	static const std::atomic<uint32>& GetRemovalEpoch() { return RemovalEpoch; }
+
+private:
+
+	FCSManagedObjectHandleEntry* GetEntry(int32 ObjectIndex) const
+	{
+		const int32 ChunkIndex = ObjectIndex / NumEntriesPerChunk;
+
+		if (ObjectIndex < 0 || ChunkIndex >= Chunks.Num() || !Chunks[ChunkIndex].IsValid())
+		{
+			return nullptr;
+		}
+
+		return &Chunks[ChunkIndex][ObjectIndex % NumEntriesPerChunk];
+	}
+
+	TArray<TUniquePtr<FCSManagedObjectHandleEntry[]>> Chunks;
+	int32 NumEntries = 0;
+
+	static inline std::atomic<uint32> RemovalEpoch { 0 };
+};
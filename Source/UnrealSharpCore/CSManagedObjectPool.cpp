@@ -0,0 +1,130 @@
+#include "CSManagedObjectPool.h"
+#include "UnrealSharpCore.h"
+#include "Logging/StructuredLog.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Object Pool Hits"), STAT_UnrealSharp_ManagedObjectPoolHits, STATGROUP_UnrealSharp);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Managed Object Pool Misses"), STAT_UnrealSharp_ManagedObjectPoolMisses, STATGROUP_UnrealSharp);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Managed Objects"), STAT_UnrealSharp_PooledManagedObjects, STATGROUP_UnrealSharp);
+
+bool FCSManagedObjectPool::QueueRelease(const UClass* Class, int32 MaxPoolSize, FGCHandle& Handle)
+{
+	if (Handle.IsNull())
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	FClassPool& Pool = Pools.FindOrAdd(Class);
+	if (Pool.Handles.Num() + Pool.NumPendingReleases >= MaxPoolSize)
+	{
+		return false;
+	}
+
+	Pool.NumPendingReleases++;
+	PendingReleases.Add({ Class, Handle.GetHandle() });
+
+	// The handle is owned by the pool now.
+	Handle = FGCHandle::Null();
+	return true;
+}
+
+void FCSManagedObjectPool::FlushPendingReleases(FGCHandleIntPtr AssemblyHandle)
+{
+	TArray<FPendingRelease> Releases;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (PendingReleases.IsEmpty())
+		{
+			return;
+		}
+
+		Releases = MoveTemp(PendingReleases);
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSManagedObjectPool::FlushPendingReleases);
+
+	TArray<FGCHandleIntPtr> Handles;
+	Handles.Reserve(Releases.Num());
+	for (const FPendingRelease& Release : Releases)
+	{
+		Handles.Add(Release.Handle);
+	}
+
+	// Disposes the C# objects so stale references see a null native object. Handles that failed to reset are freed and nulled.
+	FCSManagedCallbacks::ManagedCallbacks.ResetManagedObjectBatch(Handles.GetData(), Handles.Num(), AssemblyHandle);
+
+	FScopeLock ScopeLock(&Lock);
+	for (int32 i = 0; i < Releases.Num(); ++i)
+	{
+		FClassPool& Pool = Pools.FindChecked(Releases[i].Class);
+		Pool.NumPendingReleases--;
+
+		if (Handles[i].IntPtr != nullptr)
+		{
+			Pool.Handles.Add(Handles[i]);
+			NumPooledHandles++;
+			INC_DWORD_STAT(STAT_UnrealSharp_PooledManagedObjects);
+		}
+	}
+}
+
+bool FCSManagedObjectPool::TryAcquire(const UClass* Class, const UObject* Object, FGCHandle& OutHandle)
+{
+	FGCHandleIntPtr Handle;
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		FClassPool* Pool = Pools.Find(Class);
+		if (Pool == nullptr || Pool->Handles.IsEmpty())
+		{
+			INC_DWORD_STAT(STAT_UnrealSharp_ManagedObjectPoolMisses);
+			return false;
+		}
+
+		Handle = Pool->Handles.Pop();
+		NumPooledHandles--;
+		DEC_DWORD_STAT(STAT_UnrealSharp_PooledManagedObjects);
+	}
+
+	// C# frees the handle if the object can't be rebound.
+	if (!FCSManagedCallbacks::ManagedCallbacks.RebindManagedObject(Handle, Object))
+	{
+		UE_LOGFMT(LogUnrealSharp, Warning, "Failed to reuse pooled managed object for {0}, creating a new one.", *Object->GetName());
+		INC_DWORD_STAT(STAT_UnrealSharp_ManagedObjectPoolMisses);
+		return false;
+	}
+
+	// C# references kept past the destruction of the previous UObject now silently point to this one, unless they check the generation.
+	UE_LOGFMT(LogUnrealSharp, Verbose, "Reused pooled managed object of {0} for {1}, stale references to its previous UObject now point to it.", *Class->GetName(), *Object->GetName());
+
+	OutHandle = FGCHandle(Handle, GCHandleType::StrongHandle);
+	INC_DWORD_STAT(STAT_UnrealSharp_ManagedObjectPoolHits);
+	return true;
+}
+
+void FCSManagedObjectPool::DisposeAll(FGCHandleIntPtr AssemblyHandle)
+{
+	TArray<FGCHandleIntPtr> Handles;
+	{
+		FScopeLock ScopeLock(&Lock);
+
+		for (TPair<const UClass*, FClassPool>& Pair : Pools)
+		{
+			Handles.Append(Pair.Value.Handles);
+		}
+
+		for (const FPendingRelease& Release : PendingReleases)
+		{
+			Handles.Add(Release.Handle);
+		}
+
+		DEC_DWORD_STAT_BY(STAT_UnrealSharp_PooledManagedObjects, NumPooledHandles);
+
+		Pools.Reset();
+		PendingReleases.Reset();
+		NumPooledHandles = 0;
+	}
+
+	FGCHandle::DisposeBatch(Handles.GetData(), Handles.Num(), AssemblyHandle);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CSManagedGCHandle.h"
+
+/**
+ * Pools the C# counterparts of destroyed UObjects, per class, for classes that opt in with ManagedObjectPoolSize.
+ * Instead of freeing the GC handle when the UObject is destroyed, the C# object is reset and kept alive,
+ * so the next UObject of the same class is bound to it instead of allocating a new C# object and GC handle.
+ */
+class FCSManagedObjectPool
+{
+public:
+
+	// Takes ownership of the handle of a destroyed object. Can be called from any thread.
+	// Returns false and leaves the handle untouched if the pool for the class is full.
+	bool QueueRelease(const UClass* Class, int32 MaxPoolSize, FGCHandle& Handle);
+
+	// Resets the C# objects queued since the last flush and makes them available for reuse.
+	void FlushPendingReleases(FGCHandleIntPtr AssemblyHandle);
+
+	// Binds a pooled C# object of the class to the given UObject. Can be called from any thread.
+	bool TryAcquire(const UClass* Class, const UObject* Object, FGCHandle& OutHandle);
+
+	// Frees all pooled and queued handles. Called before the owning assembly is unloaded.
+	void DisposeAll(FGCHandleIntPtr AssemblyHandle);
+
+private:
+
+	struct FClassPool
+	{
+		TArray<FGCHandleIntPtr> Handles;
+
+		// Released handles that haven't been reset yet, counted against the pool size.
+		int32 NumPendingReleases = 0;
+	};
+
+	struct FPendingRelease
+	{
+		const UClass* Class;
+		FGCHandleIntPtr Handle;
+	};
+
+	TMap<const UClass*, FClassPool> Pools;
+	TArray<FPendingRelease> PendingReleases;
+	int32 NumPooledHandles = 0;
+
+	FCriticalSection Lock;
+};
@@ -15,6 +15,8 @@
 #include "CSUnrealSharpSettings.h"
 #include "Engine/UserDefinedEnum.h"
 #include "Logging/StructuredLog.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
 
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
 #include "StructUtils/UserDefinedStruct.h"
@@ -40,6 +42,8 @@
 #pragma clang diagnostic ignored "-Wdangling-assignment"
 #endif
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Handle Disposals"), STAT_UnrealSharp_PendingHandleDisposals, STATGROUP_UnrealSharp);
+
 UCSManager* UCSManager::Instance = nullptr;
 
 UPackage* UCSManager::FindOrAddManagedPackage(const FCSNamespace Namespace)
@@ -188,6 +192,16 @@ void UCSManager::Initialize()
 
 	GUObjectArray.AddUObjectDeleteListener(this);
 
+	// The C# objects of unreachable UObjects are cleared in one call before the purge frees them.
+	FCoreUObjectDelegates::PostReachabilityAnalysis.AddUObject(this, &UCSManager::InvalidateUnreachableManagedObjects);
+
+	// Handles of deleted objects are disposed in bulk once the GC and the frame are done.
+	FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UCSManager::FlushPendingHandleDisposals);
+	FCoreDelegates::OnEndFrame.AddUObject(this, &UCSManager::FlushPendingHandleDisposals);
+
+	// Continuations posted to the game thread from C# are invoked in batches once per tick.
+	GameThreadDispatchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UCSManager::DrainGameThreadDispatchQueue));
+
 	// Initialize the C# runtime.
 	if (!InitializeDotNetRuntime())
 	{
@@ -244,7 +258,7 @@ bool UCSManager::InitializeDotNetRuntime()
 	if (!InitializeUnrealSharp(*UserWorkingDirectory,
 		*UnrealSharpLibraryAssembly,
 		&ManagedPluginsCallbacks,
-		(const void*)&FCSBindsManager::GetBoundFunction,
+		&FCSBindsManager::GetBindsCallbacks(),
 		&FCSManagedCallbacks::ManagedCallbacks))
 	{
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to initialize UnrealSharp!"));
@@ -295,21 +309,115 @@ bool UCSManager::LoadRuntimeHost()
 	return Hostfxr_Initialize_For_Dotnet_Command_Line && Hostfxr_Get_Runtime_Delegate && Hostfxr_Close && Hostfxr_Initialize_For_Runtime_Config;
 }
 
+static TAutoConsoleVariable<bool> CVarParallelAssemblyLoading(
+	TEXT("UnrealSharp.ParallelAssemblyLoading"),
+	true,
+	TEXT("Load user assemblies that don't depend on each other in parallel at startup. Their types are still built on the game thread, in dependency order."));
+
 bool UCSManager::LoadAllUserAssemblies()
 {
-	TArray<FString> UserAssemblyPaths;
-	FCSProcHelper::GetAssemblyPathsByLoadOrder(UserAssemblyPaths, true);
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::LoadAllUserAssemblies);
+
+	TArray<FString> ProjectNames;
+	FCSProcHelper::GetProjectNamesByLoadOrder(ProjectNames, true);
 
-	if (UserAssemblyPaths.IsEmpty())
+	if (ProjectNames.IsEmpty())
 	{
 		return true;
 	}
-	
-	for (const FString& UserAssemblyPath : UserAssemblyPaths)
+
+	TMap<FString, TArray<FString>> ProjectDependencies;
+	FCSProcHelper::GetProjectDependencies(ProjectDependencies);
+
+	// Group the projects into levels that only depend on earlier levels. The load order is already sorted by dependencies.
+	// Projects without dependency information get a level of their own, so they are loaded after everything before them.
+	TMap<FString, int32> ProjectLevels;
+	TArray<TArray<FString>> Levels;
+	for (const FString& ProjectName : ProjectNames)
 	{
-		LoadAssemblyByPath(UserAssemblyPath);
+		int32 Level = Levels.Num();
+
+		if (const TArray<FString>* Dependencies = ProjectDependencies.Find(ProjectName))
+		{
+			Level = 0;
+			for (const FString& Dependency : *Dependencies)
+			{
+				if (const int32* DependencyLevel = ProjectLevels.Find(Dependency))
+				{
+					Level = FMath::Max(Level, *DependencyLevel + 1);
+				}
+			}
+		}
+
+		ProjectLevels.Add(ProjectName, Level);
+
+		if (Level >= Levels.Num())
+		{
+			Levels.SetNum(Level + 1);
+		}
+
+		Levels[Level].Add(ProjectName);
 	}
 
+	struct FPendingAssemblyLoad
+	{
+		UCSAssembly* Assembly = nullptr;
+		double LoadSeconds = 0.0;
+		bool bLoaded = false;
+	};
+
+	const FString UserAssemblyDirectory = FCSProcHelper::GetUserAssemblyDirectory();
+	const EParallelForFlags ParallelForFlags = CVarParallelAssemblyLoading.GetValueOnGameThread() ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumLoadedAssemblies = 0;
+
+	for (const TArray<FString>& Level : Levels)
+	{
+		TArray<FPendingAssemblyLoad> PendingLoads;
+		for (const FString& ProjectName : Level)
+		{
+			UCSAssembly* Assembly = FindOrCreateAssembly(FPaths::Combine(UserAssemblyDirectory, ProjectName + TEXT(".dll")));
+			if (Assembly != nullptr && !Assembly->IsValidAssembly())
+			{
+				PendingLoads.Add({ Assembly });
+			}
+		}
+
+		// Loading into the assembly load context and parsing the metadata doesn't touch any UObjects.
+		ParallelFor(PendingLoads.Num(), [&PendingLoads](int32 Index)
+		{
+			FPendingAssemblyLoad& PendingLoad = PendingLoads[Index];
+			const double LoadStartTime = FPlatformTime::Seconds();
+			PendingLoad.bLoaded = PendingLoad.Assembly->LoadManagedAssembly();
+			PendingLoad.LoadSeconds = FPlatformTime::Seconds() - LoadStartTime;
+		}, ParallelForFlags);
+
+		// The UFields are created in load order, after everything they can depend on.
+		for (const FPendingAssemblyLoad& PendingLoad : PendingLoads)
+		{
+			if (!PendingLoad.bLoaded)
+			{
+				continue;
+			}
+
+			const double BuildStartTime = FPlatformTime::Seconds();
+			PendingLoad.Assembly->FinishLoadingAssembly();
+			const double BuildSeconds = FPlatformTime::Seconds() - BuildStartTime;
+
+			OnManagedAssemblyLoaded.Broadcast(PendingLoad.Assembly->GetAssemblyName());
+			++NumLoadedAssemblies;
+
+			UE_LOGFMT(LogUnrealSharp, Display, "Loaded {0} in {1} ms ({2} ms loading and parsing metadata, {3} ms building types).",
+				*PendingLoad.Assembly->GetAssemblyName().ToString(),
+				(PendingLoad.LoadSeconds + BuildSeconds) * 1000.0,
+				PendingLoad.LoadSeconds * 1000.0,
+				BuildSeconds * 1000.0);
+		}
+	}
+
+	UE_LOGFMT(LogUnrealSharp, Display, "Loaded {0} user assemblies in {1} dependency levels in {2} ms.", NumLoadedAssemblies, Levels.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	UE_LOGFMT(LogUnrealSharp, Display, "Resolved {0} native bindings in {1} ms.", FCSBindsManager::GetNumResolvedFunctions(), FCSBindsManager::GetResolveTimeSeconds() * 1000.0);
+
 	OnAssembliesLoaded.Broadcast();
 	return true;
 }
@@ -318,14 +426,14 @@ void UCSManager::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::NotifyUObjectDeleted);
 
-	TSharedPtr<FGCHandle> Handle;
-	if (!ManagedObjectHandles.RemoveAndCopyValueByHash(Index, Index, Handle))
+	FCSManagedObjectHandleEntry Entry;
+	if (!ManagedObjectHandles.RemoveAndCopyValue(Index, Entry))
 	{
 		return;
 	}
 
-	UCSAssembly* Assembly = FindOwningAssembly(Object->GetClass());
-	if (!IsValid(Assembly))
+	UCSAssembly* Assembly = Entry.OwningAssembly;
+	if (!IsValid(Assembly) || !Assembly->IsValidAssembly())
 	{
 		FString ObjectName = Object->GetFName().ToString();
 		FString ClassName = Object->GetClass()->GetFName().ToString();
@@ -333,8 +441,10 @@ void UCSManager::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
 		return;
 	}
 
-	TSharedPtr<const FGCHandle> AssemblyHandle = Assembly->GetManagedAssemblyHandle();
-	Handle->Dispose(AssemblyHandle->GetHandle());
+	if (!Assembly->TryReleaseManagedObjectToPool(Object, Entry.Handle))
+	{
+		QueueHandleDisposal(Entry.Handle, Assembly);
+	}
 
     TMap<uint32, TSharedPtr<FGCHandle>>* FoundHandles = ManagedInterfaceWrappers.FindByHash(Index, Index);
 	if (FoundHandles == nullptr)
@@ -344,13 +454,89 @@ void UCSManager::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
 
 	for (auto &[Key, Value] : *FoundHandles)
 	{
-		Value->Dispose(AssemblyHandle->GetHandle());
+		QueueHandleDisposal(*Value, Assembly);
 	}
 	
 	FoundHandles->Empty();
 	ManagedInterfaceWrappers.Remove(Index);
 }
 
+void UCSManager::InvalidateUnreachableManagedObjects()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::InvalidateUnreachableManagedObjects);
+
+	TArray<FGCHandleIntPtr> Handles;
+	ManagedObjectHandles.CollectUnreachableHandles(Handles);
+
+	if (Handles.IsEmpty())
+	{
+		return;
+	}
+
+	FCSManagedCallbacks::ManagedCallbacks.InvalidateManagedObjectBatch(Handles.GetData(), Handles.Num());
+}
+
+void UCSManager::QueueHandleDisposal(FGCHandle& Handle, UCSAssembly* OwningAssembly)
+{
+	if (Handle.IsNull())
+	{
+		return;
+	}
+
+	{
+		FScopeLock Lock(&PendingHandleDisposalsLock);
+		PendingHandleDisposals.FindOrAdd(OwningAssembly).Add(Handle.GetHandle());
+	}
+
+	// The handle is owned by the queue now.
+	Handle = FGCHandle::Null();
+	INC_DWORD_STAT(STAT_UnrealSharp_PendingHandleDisposals);
+}
+
+void UCSManager::FlushPendingHandleDisposals()
+{
+	for (const TPair<FName, TObjectPtr<UCSAssembly>>& Pair : LoadedAssemblies)
+	{
+		Pair.Value->FlushManagedObjectPool();
+	}
+
+	TMap<UCSAssembly*, TArray<FGCHandleIntPtr>> HandlesToDispose;
+	{
+		FScopeLock Lock(&PendingHandleDisposalsLock);
+		if (PendingHandleDisposals.IsEmpty())
+		{
+			return;
+		}
+		
+		HandlesToDispose = MoveTemp(PendingHandleDisposals);
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCSManager::FlushPendingHandleDisposals);
+
+	for (TPair<UCSAssembly*, TArray<FGCHandleIntPtr>>& Pair : HandlesToDispose)
+	{
+		UCSAssembly* Assembly = Pair.Key;
+		TArray<FGCHandleIntPtr>& Handles = Pair.Value;
+		
+		if (!IsValid(Assembly) || !Assembly->IsValidAssembly())
+		{
+			UE_LOGFMT(LogUnrealSharp, Error, "Owning assembly was unloaded before {0} handles could be disposed. Will cause managed memory leak.", Handles.Num());
+			continue;
+		}
+
+		FGCHandle::DisposeBatch(Handles.GetData(), Handles.Num(), Assembly->GetManagedAssemblyHandle()->GetHandle());
+	}
+
+	SET_DWORD_STAT(STAT_UnrealSharp_PendingHandleDisposals, 0);
+}
+
+bool UCSManager::DrainGameThreadDispatchQueue(float DeltaTime)
+{
+	const float BudgetMs = GetDefault<UCSUnrealSharpSettings>()->GameThreadDispatchBudgetMs;
+	GameThreadDispatchQueue.Drain(BudgetMs / 1000.0);
+	return true;
+}
+
 void UCSManager::OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason)
 {
 	if (InModuleChangeReason != EModuleChangeReason::ModuleLoaded)
@@ -481,7 +667,7 @@ load_assembly_and_get_function_pointer_fn UCSManager::InitializeNativeHost() con
 	return (load_assembly_and_get_function_pointer_fn)LoadAssemblyAndGetFunctionPointer;
 }
 
-UCSAssembly* UCSManager::LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible)
+UCSAssembly* UCSManager::FindOrCreateAssembly(const FString& AssemblyPath)
 {
 	if (!FPaths::FileExists(AssemblyPath))
 	{
@@ -502,6 +688,16 @@ UCSAssembly* UCSManager::LoadAssemblyByPath(const FString& AssemblyPath, bool bI
 	NewAssembly->SetAssemblyPath(AssemblyPath);
 	
 	LoadedAssemblies.Add(NewAssembly->GetAssemblyName(), NewAssembly);
+	return NewAssembly;
+}
+
+UCSAssembly* UCSManager::LoadAssemblyByPath(const FString& AssemblyPath, bool bIsCollectible)
+{
+	UCSAssembly* NewAssembly = FindOrCreateAssembly(AssemblyPath);
+	if (NewAssembly == nullptr || NewAssembly->IsValidAssembly())
+	{
+		return NewAssembly;
+	}
 
 	if (!NewAssembly->LoadAssembly(bIsCollectible))
 	{
@@ -632,20 +828,10 @@ FGCHandle UCSManager::FindManagedObject(const UObject* Object)
 		return FGCHandle::Null();
 	}
 
-	uint32 ObjectID = Object->GetUniqueID();
-	if (TSharedPtr<FGCHandle>* FoundHandle = ManagedObjectHandles.FindByHash(ObjectID, ObjectID))
+	// Handles are removed from the table when their assembly is unloaded, so a hit is always a live C# counterpart.
+	if (const FCSManagedObjectHandleEntry* FoundEntry = ManagedObjectHandles.Find(Object))
 	{
-#if WITH_EDITOR
-		// During full hot reload only the managed objects are GCd as we reload the assemblies.
-		// So the C# counterpart can be invalid even if the handle can be found, so we need to create a new one.
-		TSharedPtr<FGCHandle> HandlePtr = *FoundHandle;
-		if (HandlePtr.IsValid() && !HandlePtr->IsNull())
-		{
-			return *HandlePtr;
-		}
-#else
-		return **FoundHandle;
-#endif
+		return FoundEntry->Handle;
 	}
 
 	// No existing handle found, we need to create a new managed object.
@@ -656,7 +842,7 @@ FGCHandle UCSManager::FindManagedObject(const UObject* Object)
 		return FGCHandle::Null();
 	}
 
-	return *OwningAssembly->CreateManagedObject(Object);
+	return OwningAssembly->CreateManagedObject(Object);
 }
 
 FGCHandle UCSManager::FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass)
@@ -4,6 +4,9 @@
 #include <hostfxr.h>
 #include "CSAssembly.h"
 #include "CSManagedCallbacksCache.h"
+#include "CSManagedObjectHandleTable.h"
+#include "CSGameThreadDispatchQueue.h"
+#include "Containers/Ticker.h"
 #include "CSManager.generated.h"
 
 class UCSTypeBuilderManager;
@@ -17,14 +20,19 @@ struct FCSTypeReferenceMetaData;
 
 struct FCSManagedPluginCallbacks
 {
-	using LoadPluginCallback = FGCHandleIntPtr(__stdcall*)(const TCHAR*, bool);
+	using LoadPluginCallback = FGCHandleIntPtr(__stdcall*)(const TCHAR*, bool, bool);
 	using UnloadPluginCallback = bool(__stdcall*)(const TCHAR*);
+	using StartPluginModulesCallback = bool(__stdcall*)(const TCHAR*);
 
+	// Thread safe when the modules aren't started, which is left to StartPluginModules on the game thread.
 	LoadPluginCallback LoadPlugin = nullptr;
 	UnloadPluginCallback UnloadPlugin = nullptr;
+	StartPluginModulesCallback StartPluginModules = nullptr;
 };
 
-using FInitializeRuntimeHost = bool (*)(const TCHAR*, const TCHAR*, FCSManagedPluginCallbacks*, const void*, FCSManagedCallbacks::FManagedCallbacks*);
+struct FCSBindsCallbacks;
+
+using FInitializeRuntimeHost = bool (*)(const TCHAR*, const TCHAR*, FCSManagedPluginCallbacks*, const FCSBindsCallbacks*, FCSManagedCallbacks::FManagedCallbacks*);
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnManagedAssemblyLoaded, const FName&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnManagedAssemblyUnloaded, const FName&);
@@ -87,8 +95,26 @@ public:
     }
 	
     FGCHandle FindManagedObject(const UObject* Object);
+
+	// Fast path for callers that already know the object is alive, such as the script VM invoking a managed function on it.
+	// Reads the handle table directly and only falls back to FindManagedObject when the C# counterpart doesn't exist yet.
+	FORCEINLINE FGCHandle FindManagedObjectUnchecked(const UObject* Object)
+	{
+		if (Object != nullptr)
+		{
+			if (const FCSManagedObjectHandleEntry* FoundEntry = ManagedObjectHandles.Find(Object))
+			{
+				return FoundEntry->Handle;
+			}
+		}
+
+		return FindManagedObject(Object);
+	}
     FGCHandle FindOrCreateManagedInterfaceWrapper(UObject* Object, UClass* InterfaceClass);
 
+	// Number of UObjects that currently have a C# counterpart.
+	int32 GetNumManagedObjects() const { return ManagedObjectHandles.Num(); }
+
     void SetCurrentWorldContext(UObject* WorldContext) { CurrentWorldContext = WorldContext; }
     UObject* GetCurrentWorldContext() const { return CurrentWorldContext.Get(); }
 
@@ -127,6 +153,13 @@ public:
 
 	UCSTypeBuilderManager* GetTypeBuilderManager() const { return TypeBuilderManager; }
 
+	// Queues a handle to be disposed in bulk at the end of the frame, instead of calling into C# for every handle.
+	void QueueHandleDisposal(FGCHandle& Handle, UCSAssembly* OwningAssembly);
+	void FlushPendingHandleDisposals();
+
+	// Managed continuations that are invoked on the game thread in batches, once per tick.
+	FCSGameThreadDispatchQueue& GetGameThreadDispatchQueue() { return GameThreadDispatchQueue; }
+
 private:
 
 	friend UCSAssembly;
@@ -141,15 +174,29 @@ private:
 	bool InitializeDotNetRuntime();
 	bool LoadAllUserAssemblies();
 
+	// Returns the loaded assembly at the path, or a new assembly object that still has to be loaded. Null if the file doesn't exist.
+	UCSAssembly* FindOrCreateAssembly(const FString& AssemblyPath);
+
 	// UObjectArray listener interface
 	virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
 	virtual void OnUObjectArrayShutdown() override { GUObjectArray.RemoveUObjectDeleteListener(this); }
-	void OnEnginePreExit() { GUObjectArray.RemoveUObjectDeleteListener(this); }
+	void OnEnginePreExit()
+	{
+		GUObjectArray.RemoveUObjectDeleteListener(this);
+		FTSTicker::GetCoreTicker().RemoveTicker(GameThreadDispatchTickerHandle);
+		GameThreadDispatchQueue.DisposeAll();
+		FlushPendingHandleDisposals();
+	}
 	// End of interface
 
 	void OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason);
 	void TryInitializeDynamicSubsystems();
 
+	bool DrainGameThreadDispatchQueue(float DeltaTime);
+
+	// Objects are only freed by the purge that follows a reachability analysis, so this runs before any of them is deleted.
+	void InvalidateUnreachableManagedObjects();
+
     UCSAssembly* FindOwningAssemblySlow(UField* Field);
 
 	static UCSManager* Instance;
@@ -166,13 +213,20 @@ private:
 	UPROPERTY(Transient)
 	TObjectPtr<UCSTypeBuilderManager> TypeBuilderManager;
 
-	// Handles to all active UObjects that has a C# counterpart. The key is the unique ID of the UObject.
-	TMap<uint32, TSharedPtr<FGCHandle>> ManagedObjectHandles;
+	// Handles to all active UObjects that has a C# counterpart. Indexed by the GUObjectArray index of the UObject.
+	FCSManagedObjectHandleTable ManagedObjectHandles;
 
 	// Handles all active UObjects that have interface wrappers in C#. The primary key is the unique ID of the UObject.
 	// The second key is the unique ID of the interface class.
 	TMap<uint32, TMap<uint32, TSharedPtr<FGCHandle>>> ManagedInterfaceWrappers;
 	
+	// Handles released during GC purge, grouped by owning assembly. Disposed in one managed call per assembly.
+	TMap<UCSAssembly*, TArray<FGCHandleIntPtr>> PendingHandleDisposals;
+	FCriticalSection PendingHandleDisposalsLock;
+
+	FCSGameThreadDispatchQueue GameThreadDispatchQueue;
+	FTSTicker::FDelegateHandle GameThreadDispatchTickerHandle;
+	
 	// Map to cache assemblies that native classes are associated with, for quick lookup.
 	UPROPERTY()
 	TMap<uint32, TObjectPtr<UCSAssembly>> NativeClassToAssemblyMap;
@@ -24,6 +24,11 @@ public:
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Debugging")
 	bool bCrashOnException = true;
 
+	// Max time per frame spent invoking C# continuations that were posted to the game thread (e.g. awaits resuming on the game thread).
+	// Continuations that don't fit in the budget are carried over to the next frame.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance", meta = (ClampMin = 0, Units = "ms"))
+	float GameThreadDispatchBudgetMs = 2.0f;
+
 	bool HasNamespaceSupport() const;
 
 protected:
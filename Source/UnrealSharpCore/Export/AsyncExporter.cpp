@@ -1,8 +1,16 @@
 ﻿#include "AsyncExporter.h"
 #include "CSManagedDelegate.h"
+#include "CSManager.h"
 
 void UAsyncExporter::RunOnThread(TWeakObjectPtr<UObject> WorldContextObject, ENamedThreads::Type Thread, FGCHandleIntPtr DelegateHandle)
 {
+	if (ENamedThreads::GetThreadIndex(Thread) == ENamedThreads::GameThread)
+	{
+		// Game thread continuations are batched and invoked once per tick, instead of one task per continuation.
+		UCSManager::Get().GetGameThreadDispatchQueue().Enqueue(WorldContextObject, DelegateHandle);
+		return;
+	}
+	
 	AsyncTask(Thread, [WorldContextObject, DelegateHandle]()
 	{
 		FCSManagedDelegate ManagedDelegate = FGCHandle(DelegateHandle, GCHandleType::StrongHandle);
@@ -41,3 +41,26 @@ void UFArrayPropertyExporter::SwapValues(FArrayProperty* ArrayProperty, const vo
 	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
 	Helper.SwapValues(indexA, indexB);
 }
+
+bool UFArrayPropertyExporter::IsBulkCopyCompatible(FArrayProperty* ArrayProperty, int ElementSize)
+{
+	const FProperty* Inner = ArrayProperty->Inner;
+	if (!Inner->HasAnyPropertyFlags(CPF_IsPlainOldData) || Inner->GetElementSize() != ElementSize)
+	{
+		return false;
+	}
+
+	// Mirrors the managed side, which only allows primitives and blittable structs.
+	if (Inner->IsA<FNumericProperty>() || Inner->IsA<FEnumProperty>())
+	{
+		return true;
+	}
+
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Inner))
+	{
+		return BoolProperty->IsNativeBool();
+	}
+
+	const FStructProperty* StructProperty = CastField<FStructProperty>(Inner);
+	return StructProperty && (StructProperty->Struct->StructFlags & STRUCT_IsPlainOldData) != 0;
+}
@@ -33,5 +33,9 @@ public:
 
 	UNREALSHARP_FUNCTION()
 	static void SwapValues(FArrayProperty* ArrayProperty, const void* ScriptArray, int indexA, int indexB);
+
+	// True if the elements are primitives or plain old data structs with the given element size, and can be accessed as raw memory.
+	UNREALSHARP_FUNCTION()
+	static bool IsBulkCopyCompatible(FArrayProperty* ArrayProperty, int ElementSize);
 	
 };
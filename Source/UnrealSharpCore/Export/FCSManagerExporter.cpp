@@ -1,5 +1,6 @@
 ﻿#include "FCSManagerExporter.h"
 #include "UnrealSharpCore/CSManager.h"
+#include "UnrealSharpCore/UnrealSharpCore.h"
 
 void* UFCSManagerExporter::FindManagedObject(UObject* Object)
 {
@@ -21,3 +22,13 @@ void* UFCSManagerExporter::GetCurrentWorldPtr()
 	UObject* WorldContext = UCSManager::Get().GetCurrentWorldContext();
 	return GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
 }
+
+const void* UFCSManagerExporter::GetManagedObjectRemovalEpoch()
+{
+	return &FCSManagedObjectHandleTable::GetRemovalEpoch();
+}
+
+bool UFCSManagerExporter::IsValidObject(UObject* Object)
+{
+	return IsValid(Object);
+}
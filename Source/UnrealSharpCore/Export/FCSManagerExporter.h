@@ -24,5 +24,12 @@ public:
 	
 	UNREALSHARP_FUNCTION()
 	static void* GetCurrentWorldPtr();
+
+	UNREALSHARP_FUNCTION()
+	static const void* GetManagedObjectRemovalEpoch();
+
+	// The IsValid check of FindManagedObject, for lookups that C# resolved from its cache.
+	UNREALSHARP_FUNCTION()
+	static bool IsValidObject(UObject* Object);
 	
 };
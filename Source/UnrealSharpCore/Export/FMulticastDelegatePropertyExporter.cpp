@@ -1,4 +1,18 @@
 ﻿#include "FMulticastDelegatePropertyExporter.h"
+#include "UnrealSharpCore/UnrealSharpCore.h"
+
+UFunction* FCSDelegateBinding::ResolveFunction() const
+{
+	if (UFunction* CachedFunction = Function.Get())
+	{
+		return CachedFunction;
+	}
+
+	const UObject* Target = ScriptDelegate.GetUObject();
+	UFunction* FoundFunction = IsValid(Target) ? Target->FindFunction(ScriptDelegate.GetFunctionName()) : nullptr;
+	Function = FoundFunction;
+	return FoundFunction;
+}
 
 void UFMulticastDelegatePropertyExporter::AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
 {
@@ -30,7 +44,12 @@ void UFMulticastDelegatePropertyExporter::ClearDelegate(FMulticastDelegateProper
 void UFMulticastDelegatePropertyExporter::BroadcastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, void* Parameters)
 {
 	Delegate = TryGetSparseMulticastDelegate(DelegateProperty, Delegate);
-	Delegate->ProcessMulticastDelegate<UObject>(Parameters);
+
+	// Sparse delegates have no storage until something is bound.
+	if (Delegate != nullptr)
+	{
+		Delegate->ProcessMulticastDelegate<UObject>(Parameters);
+	}
 }
 
 bool UFMulticastDelegatePropertyExporter::ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
@@ -52,6 +71,51 @@ FScriptDelegate UFMulticastDelegatePropertyExporter::MakeScriptDelegate(UObject*
 	return NewDelegate;
 }
 
+FCSDelegateBinding* UFMulticastDelegatePropertyExporter::CreateBinding(UObject* Target, const char* FunctionName)
+{
+	FCSDelegateBinding* Binding = new FCSDelegateBinding();
+	Binding->ScriptDelegate = MakeScriptDelegate(Target, FunctionName);
+	Binding->ResolveFunction();
+	return Binding;
+}
+
+void UFMulticastDelegatePropertyExporter::ReleaseBinding(FCSDelegateBinding* Binding)
+{
+	delete Binding;
+}
+
+void UFMulticastDelegatePropertyExporter::AddBinding(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, const FCSDelegateBinding* Binding)
+{
+	if (!Binding->ResolveFunction())
+	{
+		UE_LOG(LogUnrealSharp, Error, TEXT("Can't add %s to %s, the target has no function with that name."), *Binding->ScriptDelegate.ToString<UObject>(), *DelegateProperty->GetName());
+		return;
+	}
+
+	DelegateProperty->AddDelegate(Binding->ScriptDelegate, nullptr, Delegate);
+}
+
+void UFMulticastDelegatePropertyExporter::RemoveBinding(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, const FCSDelegateBinding* Binding)
+{
+	DelegateProperty->RemoveDelegate(Binding->ScriptDelegate, nullptr, Delegate);
+}
+
+bool UFMulticastDelegatePropertyExporter::ContainsBinding(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, const FCSDelegateBinding* Binding)
+{
+	Delegate = TryGetSparseMulticastDelegate(DelegateProperty, Delegate);
+	return Delegate != nullptr && Delegate->Contains(Binding->ScriptDelegate);
+}
+
+bool UFMulticastDelegatePropertyExporter::IsSparseDelegate(FMulticastDelegateProperty* DelegateProperty)
+{
+	return DelegateProperty->IsA<FMulticastSparseDelegateProperty>();
+}
+
+void UFMulticastDelegatePropertyExporter::BroadcastInlineDelegate(const FMulticastScriptDelegate* Delegate, void* Parameters)
+{
+	Delegate->ProcessMulticastDelegate<UObject>(Parameters);
+}
+
 const FMulticastScriptDelegate* UFMulticastDelegatePropertyExporter::TryGetSparseMulticastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate)
 {
 	// If the delegate is a sparse delegate, we need to get the multicast delegate from FSparseDelegate wrapper.
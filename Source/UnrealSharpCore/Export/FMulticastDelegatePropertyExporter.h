@@ -19,6 +19,19 @@ struct Interop_FScriptDelegate
 	}
 };
 
+// Pre-resolved target and function for a delegate binding. Created once from C# and reused for add/remove/contains,
+// so the function name doesn't have to be marshalled and converted to an FName on every call.
+struct FCSDelegateBinding
+{
+	FScriptDelegate ScriptDelegate;
+
+	// The function the binding resolved to. Re-resolved if the class was reinstanced since, e.g. after a hot reload.
+	mutable TWeakObjectPtr<UFunction> Function;
+
+	// Null if the target doesn't have the function, in which case the binding must not be added since broadcasting it would assert.
+	UFunction* ResolveFunction() const;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UFMulticastDelegatePropertyExporter : public UObject
 {
@@ -52,6 +65,28 @@ public:
 	UNREALSHARP_FUNCTION()
 	static FScriptDelegate MakeScriptDelegate(UObject* Target, const char* FunctionName);
 
+	UNREALSHARP_FUNCTION()
+	static FCSDelegateBinding* CreateBinding(UObject* Target, const char* FunctionName);
+
+	UNREALSHARP_FUNCTION()
+	static void ReleaseBinding(FCSDelegateBinding* Binding);
+
+	UNREALSHARP_FUNCTION()
+	static void AddBinding(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, const FCSDelegateBinding* Binding);
+
+	UNREALSHARP_FUNCTION()
+	static void RemoveBinding(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, const FCSDelegateBinding* Binding);
+
+	UNREALSHARP_FUNCTION()
+	static bool ContainsBinding(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, const FCSDelegateBinding* Binding);
+
+	// Sparse delegates have to be resolved through their owner on every broadcast, inline delegates can be broadcast directly.
+	UNREALSHARP_FUNCTION()
+	static bool IsSparseDelegate(FMulticastDelegateProperty* DelegateProperty);
+
+	UNREALSHARP_FUNCTION()
+	static void BroadcastInlineDelegate(const FMulticastScriptDelegate* Delegate, void* Parameters);
+
 	UNREALSHARP_FUNCTION()
 	static const FMulticastScriptDelegate* TryGetSparseMulticastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate);
 	
@@ -1,6 +1,8 @@
 ﻿#include "UObjectExporter.h"
 #include "UnrealSharpCore/CSManager.h"
 #include "UObject/UObjectGlobals.h"
+#include "UObject/ObjectKey.h"
+#include "Misc/ScopeRWLock.h"
 
 
 void* UUObjectExporter::CreateNewObject(UObject* Outer, UClass* Class, UObject* Template)
@@ -31,23 +33,141 @@ void UUObjectExporter::NativeGetName(UObject* Object, FName* OutName)
 	*OutName = !IsValid(Object) ? NAME_None : Object->GetFName();
 }
 
-void EvaluateInvokePath(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
+namespace
 {
-	if (NativeFunction->HasAllFunctionFlags(FUNC_HasOutParms))
+	enum class ECSNativeInvokePath : uint8
 	{
-		UUObjectExporter::InvokeNativeFunctionOutParms(NativeObject, NativeFunction, Params, ReturnValueAddress);
+		Invoke,
+		InvokeWithOutParms,
+		ProcessEvent,
+	};
+
+	struct FCSNativeFunctionInvokeInfo
+	{
+		// Out parameters in the order the FOutParmRec chain has to be linked.
+		TArray<FProperty*> OutParameters;
+
+		// Used to detect functions that have been relinked since the info was built.
+		FField* ChildProperties = nullptr;
+
+		ECSNativeInvokePath InvokePath = ECSNativeInvokePath::Invoke;
+	};
+
+	using FCSNativeFunctionInvokeInfoRef = TSharedRef<const FCSNativeFunctionInvokeInfo>;
+
+	// Resolved lazily per function on the first call from C#, which can come from any thread. Cleared whenever an assembly is unloaded for hot reload.
+	// Infos are immutable once built and handed out as shared refs, so a caller's info stays alive while the map is cleared or rebuilt.
+	TMap<TObjectKey<UFunction>, FCSNativeFunctionInvokeInfoRef> NativeFunctionInvokeInfos;
+	FRWLock NativeFunctionInvokeInfosLock;
+
+	FCSNativeFunctionInvokeInfoRef BuildInvokeInfo(UFunction* NativeFunction)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UUObjectExporter::BuildInvokeInfo);
+
+		TSharedRef<FCSNativeFunctionInvokeInfo> InvokeInfo = MakeShared<FCSNativeFunctionInvokeInfo>();
+
+		for (TFieldIterator<FProperty> PropIt(NativeFunction); PropIt; ++PropIt)
+		{
+			FProperty* Property = *PropIt;
+
+			if (Property->HasAllPropertyFlags(CPF_OutParm))
+			{
+				InvokeInfo->OutParameters.Add(Property);
+			}
+		}
+
+		//if the function is an event and not native we would go through UObject::ProcessEvent to avoid stack corruption since it will call into BP code
+		if (!NativeFunction->HasAnyFunctionFlags(FUNC_Native) && NativeFunction->HasAnyFunctionFlags(FUNC_Event))
+		{
+			InvokeInfo->InvokePath = ECSNativeInvokePath::ProcessEvent;
+		}
+		else if (NativeFunction->HasAllFunctionFlags(FUNC_HasOutParms))
+		{
+			InvokeInfo->InvokePath = ECSNativeInvokePath::InvokeWithOutParms;
+		}
+		//if the function is native we can go through the fast path. it could also contain the event flag which is common for u# functions
+		else
+		{
+			InvokeInfo->InvokePath = ECSNativeInvokePath::Invoke;
+		}
+
+		InvokeInfo->ChildProperties = NativeFunction->ChildProperties;
+		return InvokeInfo;
 	}
-    //if the function is an event and not native we would go through UObject::ProcessEvent to avoid stack corruption since it will call into BP code
-	else if (!NativeFunction->HasAnyFunctionFlags(FUNC_Native) && NativeFunction->HasAnyFunctionFlags(FUNC_Event))
+
+	FCSNativeFunctionInvokeInfoRef FindOrAddInvokeInfo(UFunction* NativeFunction)
 	{
-		NativeObject->ProcessEvent(NativeFunction, Params);
+		{
+			FReadScopeLock ReadLock(NativeFunctionInvokeInfosLock);
+			const FCSNativeFunctionInvokeInfoRef* FoundInvokeInfo = NativeFunctionInvokeInfos.Find(NativeFunction);
+
+			if (FoundInvokeInfo != nullptr && (*FoundInvokeInfo)->ChildProperties == NativeFunction->ChildProperties)
+			{
+				return *FoundInvokeInfo;
+			}
+		}
+
+		FCSNativeFunctionInvokeInfoRef InvokeInfo = BuildInvokeInfo(NativeFunction);
+
+		FWriteScopeLock WriteLock(NativeFunctionInvokeInfosLock);
+
+		static FDelegateHandle OnAssemblyUnloadedHandle;
+		if (!OnAssemblyUnloadedHandle.IsValid())
+		{
+			OnAssemblyUnloadedHandle = UCSManager::Get().OnManagedAssemblyUnloadedEvent().AddLambda([](const FName&)
+			{
+				FWriteScopeLock WriteLock(NativeFunctionInvokeInfosLock);
+				NativeFunctionInvokeInfos.Empty();
+			});
+		}
+
+		NativeFunctionInvokeInfos.Add(NativeFunction, InvokeInfo);
+		return InvokeInfo;
 	}
-    //if the function is native we can go through the fast path. it could also contain the event flag which is common for u# functions
-	else
+
+	void InvokeWithOutParms(UObject* NativeObject, UFunction* NativeFunction, const FCSNativeFunctionInvokeInfo& InvokeInfo, uint8* Params, uint8* ReturnValueAddress)
 	{
 		FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
+
+		const int32 NumOutParameters = InvokeInfo.OutParameters.Num();
+		if (NumOutParameters > 0)
+		{
+			FOutParmRec* OutParms = static_cast<FOutParmRec*>(UE_VSTACK_ALLOC(VirtualStackAllocator, sizeof(FOutParmRec) * NumOutParameters));
+
+			for (int32 i = 0; i < NumOutParameters; ++i)
+			{
+				FProperty* Property = InvokeInfo.OutParameters[i];
+				OutParms[i].Property = Property;
+				OutParms[i].PropAddr = Property->ContainerPtrToValuePtr<uint8>(Params);
+				OutParms[i].NextOutParm = i + 1 < NumOutParameters ? &OutParms[i + 1] : nullptr;
+			}
+
+			NewStack.OutParms = OutParms;
+		}
+
 		NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
 	}
+
+	void EvaluateInvokePath(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
+	{
+		const FCSNativeFunctionInvokeInfoRef InvokeInfo = FindOrAddInvokeInfo(NativeFunction);
+
+		switch (InvokeInfo->InvokePath)
+		{
+		case ECSNativeInvokePath::ProcessEvent:
+			NativeObject->ProcessEvent(NativeFunction, Params);
+			break;
+		case ECSNativeInvokePath::InvokeWithOutParms:
+			InvokeWithOutParms(NativeObject, NativeFunction, *InvokeInfo, Params, ReturnValueAddress);
+			break;
+		default:
+			{
+				FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
+				NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
+				break;
+			}
+		}
+	}
 }
 
 void UUObjectExporter::InvokeNativeFunction(UObject* NativeObject, UFunction* NativeFunction, uint8* Params, uint8* ReturnValueAddress)
@@ -89,48 +209,17 @@ void UUObjectExporter::InvokeNativeFunctionOutParms(UObject* NativeObject, UFunc
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UUObjectExporter::InvokeNativeFunctionOutParms);
 
+	const FCSNativeFunctionInvokeInfoRef InvokeInfo = FindOrAddInvokeInfo(NativeFunction);
+
     //choose a most fast path. the assumption is that functions defined in U# which are not overridden in BP code can choose a fast path.
     //if the function calls into BP code we need dedicated stack memory to not risk a stack corruption for BP to use.
-	if (!NativeFunction->HasAnyFunctionFlags(FUNC_Native) && NativeFunction->HasAnyFunctionFlags(FUNC_Event))
+	if (InvokeInfo->InvokePath == ECSNativeInvokePath::ProcessEvent)
 	{
 		NativeObject->ProcessEvent(NativeFunction, Params);
 	}
 	else
 	{
-		FFrame NewStack(NativeObject, NativeFunction, Params, nullptr, NativeFunction->ChildProperties);
-		FOutParmRec** LastOut = &NewStack.OutParms;
-
-		for (TFieldIterator<FProperty> PropIt(NativeFunction); PropIt; ++PropIt)
-		{
-			FProperty* Property = *PropIt;
-
-			if (!Property->HasAllPropertyFlags(CPF_OutParm))
-			{
-				continue;
-			}
-
-			FOutParmRec* Out = static_cast<FOutParmRec*>(UE_VSTACK_ALLOC(VirtualStackAllocator, sizeof(FOutParmRec)));
-
-			Out->PropAddr = Property->ContainerPtrToValuePtr<uint8>(Params);
-			Out->Property = Property;
-
-			if (*LastOut)
-			{
-				(*LastOut)->NextOutParm = Out;
-				LastOut = &(*LastOut)->NextOutParm;
-			}
-			else
-			{
-				*LastOut = Out;
-			}
-		}
-
-		if (*LastOut)
-		{
-			(*LastOut)->NextOutParm = nullptr;
-		}
-
-		NativeFunction->Invoke(NativeObject, NewStack, ReturnValueAddress);
+		InvokeWithOutParms(NativeObject, NativeFunction, *InvokeInfo, Params, ReturnValueAddress);
 	}
 }
 
@@ -0,0 +1,79 @@
+#include "Misc/AutomationTest.h"
+#include "CSManager.h"
+#include "CSManagedObjectHandleTable.h"
+#include "Export/FCSManagerExporter.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// These cover what ManagedObjectCache.cs relies on: a cache hit defers to IsValidObject, and any removal bumps the epoch that invalidates the cache.
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedObjectGarbageLookupTest, "UnrealSharp.ManagedObjects.GarbageLookup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCSManagedObjectGarbageLookupTest::RunTest(const FString& Parameters)
+{
+	UCSManager& Manager = UCSManager::Get();
+
+	UObject* Object = NewObject<UObject>(GetTransientPackage());
+	TestFalse(TEXT("A live object resolves to its C# object"), Manager.FindManagedObject(Object).IsNull());
+	TestTrue(TEXT("IsValidObject is true for a live object"), UFCSManagerExporter::IsValidObject(Object));
+
+	Object->MarkAsGarbage();
+	TestTrue(TEXT("An object marked as garbage resolves to null"), Manager.FindManagedObject(Object).IsNull());
+	TestFalse(TEXT("IsValidObject is false for an object marked as garbage"), UFCSManagerExporter::IsValidObject(Object));
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedObjectPointerReuseTest, "UnrealSharp.ManagedObjects.PointerReuseAfterGC",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCSManagedObjectPointerReuseTest::RunTest(const FString& Parameters)
+{
+	// The object allocator hands freed addresses out again quickly, this is only a bound for when it doesn't.
+	constexpr int32 MaxAllocations = 4096;
+
+	UCSManager& Manager = UCSManager::Get();
+
+	UObject* Object = NewObject<UObject>(GetTransientPackage());
+	const UObject* FreedAddress = Object;
+
+	if (!TestFalse(TEXT("A live object resolves to its C# object"), Manager.FindManagedObject(Object).IsNull()))
+	{
+		return false;
+	}
+
+	const int32 NumManagedObjectsBeforeGC = Manager.GetNumManagedObjects();
+	const uint32 EpochBeforeGC = FCSManagedObjectHandleTable::GetRemovalEpoch().load();
+
+	Object->MarkAsGarbage();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+	TestEqual(TEXT("Freeing the object removes its handle"), Manager.GetNumManagedObjects(), NumManagedObjectsBeforeGC - 1);
+	TestNotEqual(TEXT("Freeing the object bumps the removal epoch"), FCSManagedObjectHandleTable::GetRemovalEpoch().load(), EpochBeforeGC);
+
+	TArray<TStrongObjectPtr<UObject>> Allocations;
+	for (int32 Index = 0; Index < MaxAllocations; ++Index)
+	{
+		UObject* NewObj = NewObject<UObject>(GetTransientPackage());
+		Allocations.Emplace(NewObj);
+
+		if (NewObj != FreedAddress)
+		{
+			continue;
+		}
+
+		const int32 NumManagedObjectsBeforeLookup = Manager.GetNumManagedObjects();
+		TestFalse(TEXT("The object at the reused address resolves to a C# object"), Manager.FindManagedObject(NewObj).IsNull());
+		TestEqual(TEXT("The object at the reused address gets a new C# object instead of the stale one"), Manager.GetNumManagedObjects(), NumManagedObjectsBeforeLookup + 1);
+		return true;
+	}
+
+	AddWarning(TEXT("The freed address wasn't reused, so the lookup of a reused address wasn't checked."));
+	return true;
+}
+
+#endif
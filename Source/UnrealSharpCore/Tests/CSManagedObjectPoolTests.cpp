@@ -0,0 +1,94 @@
+#include "Misc/AutomationTest.h"
+#include "CSManager.h"
+#include "GameFramework/Actor.h"
+#include "TypeGenerator/CSClass.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+	// Any managed class that can be created without a world works, the pool doesn't depend on the class.
+	UCSClass* FindPoolableManagedClass()
+	{
+		for (TObjectIterator<UCSClass> It; It; ++It)
+		{
+			UCSClass* Class = *It;
+			if (!Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists) && !Class->IsChildOf<AActor>())
+			{
+				return Class;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedObjectPoolStressTest, "UnrealSharp.ManagedObjects.PoolSpawnDestroyStress",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FCSManagedObjectPoolStressTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 PoolSize = 32;
+	constexpr int32 NumRounds = 50;
+
+	UCSClass* Class = FindPoolableManagedClass();
+	if (Class == nullptr)
+	{
+		AddWarning(TEXT("No managed class is loaded, so the managed object pool wasn't checked."));
+		return true;
+	}
+
+	UCSManager& Manager = UCSManager::Get();
+
+	const int32 OriginalPoolSize = Class->GetManagedObjectPoolSize();
+	Class->SetManagedObjectPoolSize(PoolSize);
+
+	TSet<uint8*> PreviousHandles;
+
+	for (int32 Round = 0; Round < NumRounds; ++Round)
+	{
+		TArray<UObject*> Objects;
+		TSet<uint8*> Handles;
+
+		for (int32 Index = 0; Index < PoolSize; ++Index)
+		{
+			UObject* Object = NewObject<UObject>(GetTransientPackage(), Class);
+			FGCHandle Handle = Manager.FindManagedObject(Object);
+
+			if (!TestFalse(TEXT("A spawned object resolves to a C# object"), Handle.IsNull()))
+			{
+				Class->SetManagedObjectPoolSize(OriginalPoolSize);
+				return false;
+			}
+
+			TestFalse(TEXT("Live objects never share a C# object"), Handles.Contains(Handle.GetPointer()));
+			Handles.Add(Handle.GetPointer());
+			Objects.Add(Object);
+		}
+
+		// Everything destroyed in the previous round fits in the pool, so every spawn is served from it.
+		if (Round > 0)
+		{
+			TestTrue(FString::Printf(TEXT("Round %d reuses the C# objects of the destroyed objects"), Round), Handles.Includes(PreviousHandles));
+		}
+
+		for (UObject* Object : Objects)
+		{
+			Object->MarkAsGarbage();
+		}
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+		// Resets the released C# objects and makes them available to the next round.
+		Manager.FlushPendingHandleDisposals();
+
+		PreviousHandles = MoveTemp(Handles);
+	}
+
+	Class->SetManagedObjectPoolSize(OriginalPoolSize);
+	return true;
+}
+
+#endif
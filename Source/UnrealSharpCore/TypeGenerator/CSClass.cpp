@@ -1,6 +1,7 @@
 ﻿#include "CSClass.h"
 #include "UnrealSharpCore.h"
 #include "Register/TypeInfo/CSClassInfo.h"
+#include "Utils/CSClassUtilities.h"
 
 #if WITH_EDITOR
 void UCSClass::PostDuplicate(bool bDuplicateForPIE)
@@ -23,3 +24,34 @@ void UCSClass::PostDuplicate(bool bDuplicateForPIE)
 	SetTypeInfo(ManagedClass->GetManagedTypeInfo<FCSClassInfo>());
 }
 #endif
+
+void UCSClass::Link(FArchive& Ar, bool bRelinkExistingProperties)
+{
+	Super::Link(Ar, bRelinkExistingProperties);
+	BuildPropertyInitializers();
+}
+
+void UCSClass::BuildPropertyInitializers()
+{
+	FirstNativeClass = FCSClassUtilities::GetFirstNativeClass(this);
+	PropertyInitializers.Reset();
+
+	// Properties that are not zero initialized, such as FText.
+	for (TFieldIterator<FProperty> PropertyIt(this); PropertyIt; ++PropertyIt)
+	{
+		FProperty* Property = *PropertyIt;
+
+		if (!FCSClassUtilities::IsManagedClass(Property->GetOwnerClass()))
+		{
+			// We don't want to initialize properties that are not from a managed class
+			break;
+		}
+
+		if (Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
+		{
+			continue;
+		}
+
+		PropertyInitializers.Add({ Property, Property->GetOffset_ForInternal() });
+	}
+}
@@ -5,6 +5,12 @@
 #include "Engine/BlueprintGeneratedClass.h"
 #include "CSClass.generated.h"
 
+struct FCSPropertyInitializer
+{
+	FProperty* Property;
+	int32 Offset;
+};
+
 UCLASS()
 class UNREALSHARPCORE_API UCSClass : public UBlueprintGeneratedClass, public ICSManagedTypeInterface
 {
@@ -15,4 +21,28 @@ public:
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 	// End of UObject interface
 #endif
+
+	// UStruct interface
+	virtual void Link(FArchive& Ar, bool bRelinkExistingProperties) override;
+	// End of UStruct interface
+
+	// The closest native ancestor, whose constructor runs before the managed properties are initialized.
+	UClass* GetFirstNativeClass() const { return FirstNativeClass; }
+
+	// Managed properties, including inherited ones from other managed classes, that need to be initialized on construction.
+	const TArray<FCSPropertyInitializer>& GetPropertyInitializers() const { return PropertyInitializers; }
+
+	void SetManagedObjectPoolSize(int32 InManagedObjectPoolSize) { ManagedObjectPoolSize = InManagedObjectPoolSize; }
+	int32 GetManagedObjectPoolSize() const { return ManagedObjectPoolSize; }
+
+private:
+	void BuildPropertyInitializers();
+
+	// Cached when the class is linked, so constructing an object doesn't walk the class hierarchy.
+	// Native classes are never garbage collected, so this doesn't need to be a UPROPERTY.
+	UClass* FirstNativeClass = nullptr;
+
+	TArray<FCSPropertyInitializer> PropertyInitializers;
+
+	int32 ManagedObjectPoolSize = 0;
 };
\ No newline at end of file
@@ -127,6 +127,7 @@ void FCSFunctionFactory::FinalizeFunctionSetup(UClass* Outer, UCSFunctionBase* F
 	}
 	else
 	{
+		Function->BuildMarshallingPlan();
 		Outer->AddNativeFunction(*Function->GetName(), &UCSFunction_Params::InvokeManagedMethod_Params);
 	}
 	
@@ -100,15 +100,15 @@ void FCSPropertyFactory::CreateAndAssignProperties(UField* Outer, const TArray<F
 	}
 }
 
-TSharedPtr<FCSUnrealType> FCSPropertyFactory::CreateTypeMetaData(const TSharedPtr<FJsonObject>& PropertyMetaData)
+TSharedPtr<FCSUnrealType> FCSPropertyFactory::CreateTypeMetaData(const FCSMetaDataValue& PropertyMetaData)
 {
-	const TSharedPtr<FJsonObject>& PropertyTypeObject = PropertyMetaData->GetObjectField(TEXT("PropertyDataType"));
-	ECSPropertyType PropertyType = static_cast<ECSPropertyType>(PropertyTypeObject->GetIntegerField(TEXT("PropertyType")));
+	const FCSMetaDataValue PropertyTypeObject = PropertyMetaData.GetField(TEXT("PropertyDataType"));
+	ECSPropertyType PropertyType = static_cast<ECSPropertyType>(PropertyTypeObject.GetIntegerField(TEXT("PropertyType")));
 	
 	UCSPropertyGenerator* PropertyGenerator = FindPropertyGenerator(PropertyType);
 	TSharedPtr<FCSUnrealType> PropertiesMetaData = PropertyGenerator->CreateTypeMetaData(PropertyType);
 	
-	PropertiesMetaData->SerializeFromJson(PropertyTypeObject);
+	PropertiesMetaData->Serialize(PropertyTypeObject);
 	return PropertiesMetaData;
 }
 
@@ -66,7 +66,10 @@ void UCSFunctionBase::InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Sta
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunctionBase::InvokeManagedMethod);
 	
 	Stack.Code += !!Stack.Code;
-	UCSManager::Get().SetCurrentWorldContext(Stack.Object);
+
+	UCSManager& Manager = UCSManager::Get();
+	Manager.SetCurrentWorldContext(Stack.Object);
+	
 	UCSFunctionBase* ManagedFunction = static_cast<UCSFunctionBase*>(Stack.CurrentNativeFunction);
 	
 #if WITH_EDITOR
@@ -77,8 +80,9 @@ void UCSFunctionBase::InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Sta
 	}
 #endif
 
-	FGCHandle ManagedObjectHandle = UCSManager::Get().FindManagedObject(ObjectToInvokeOn);
-	
+	FGCHandle ManagedObjectHandle = Manager.FindManagedObjectUnchecked(ObjectToInvokeOn);
+
+	// Only written to by C# when an exception is thrown, so this doesn't allocate on the common path.
 	FString ExceptionMessage;
 	if (!FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(ManagedObjectHandle.GetPointer(),
 		ManagedFunction->MethodHandle->GetPointer(),
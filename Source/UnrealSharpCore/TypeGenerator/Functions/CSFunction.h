@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "CSManagedGCHandle.h"
+#include "CSFunctionMarshallingPlan.h"
 #include "CSFunction.generated.h"
 
 struct FGCHandle;
@@ -26,8 +27,22 @@ public:
 		return MethodHandle.IsValid() && !MethodHandle->IsNull();
 	}
 
+	// Built when the function is finalized. Functions duplicated by the Blueprint compiler build it lazily on first call.
+	const FCSFunctionMarshallingPlan& GetMarshallingPlan()
+	{
+		if (!MarshallingPlan.IsBuilt())
+		{
+			MarshallingPlan.Build(this);
+		}
+
+		return MarshallingPlan;
+	}
+
+	void BuildMarshallingPlan() { MarshallingPlan.Build(this); }
+
 	static void InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Stack, RESULT_DECL);
 	static void InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Stack, RESULT_DECL, UObject* WorldContextObject);
 private:
 	TSharedPtr<FGCHandle> MethodHandle = nullptr;
+	FCSFunctionMarshallingPlan MarshallingPlan;
 };
@@ -0,0 +1,40 @@
+#include "CSFunctionMarshallingPlan.h"
+#include "CSFunction_Params.h"
+
+void FCSFunctionMarshallingPlan::Build(const UFunction* Function)
+{
+	Parameters.Reset();
+	OutParameterIndices.Reset();
+
+	StructureSize = Function->GetStructureSize();
+	bRequiresInitialization = false;
+	bRequiresDestruction = false;
+
+	for (TFieldIterator<FProperty> ParamIt(Function, EFieldIteratorFlags::ExcludeSuper); ParamIt; ++ParamIt)
+	{
+		FProperty* FunctionParameter = *ParamIt;
+
+		bRequiresInitialization |= !FunctionParameter->HasAnyPropertyFlags(CPF_ZeroConstructor);
+		bRequiresDestruction |= !FunctionParameter->HasAnyPropertyFlags(CPF_NoDestructor | CPF_IsPlainOldData);
+
+		if (FunctionParameter->HasAnyPropertyFlags(CPF_ReturnParm))
+		{
+			continue;
+		}
+
+		FCSParameterMarshallingEntry& Entry = Parameters.AddDefaulted_GetRef();
+		Entry.Property = FunctionParameter;
+		Entry.PropertyClass = FunctionParameter->GetClass();
+		Entry.Offset = FunctionParameter->GetOffset_ForUFunction();
+		Entry.Size = FunctionParameter->GetSize();
+		Entry.bIsPlainOldData = FunctionParameter->HasAnyPropertyFlags(CPF_IsPlainOldData);
+		Entry.bIsReference = FunctionParameter->HasAnyPropertyFlags(CPF_OutParm);
+
+		if (UCSFunction_Params::IsOutParameter(FunctionParameter))
+		{
+			Entry.OutParameterIndex = OutParameterIndices.Add(Parameters.Num() - 1);
+		}
+	}
+
+	bIsBuilt = true;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FCSParameterMarshallingEntry
+{
+	FProperty* Property = nullptr;
+	FFieldClass* PropertyClass = nullptr;
+
+	int32 Offset = 0;
+	int32 Size = 0;
+
+	// Index into FCSFunctionMarshallingPlan::OutParameterIndices, or INDEX_NONE if the value isn't copied back.
+	int32 OutParameterIndex = INDEX_NONE;
+
+	// Can be copied with a memcpy instead of going through the property.
+	bool bIsPlainOldData = false;
+
+	// Passed by reference from the script VM, the value lives in the caller's frame.
+	bool bIsReference = false;
+};
+
+/**
+ * Flat description of how the parameters of a managed UFunction are read from a Blueprint stack frame.
+ * Built once per function so the invoker doesn't have to iterate and inspect the properties on every call.
+ */
+struct FCSFunctionMarshallingPlan
+{
+	void Build(const UFunction* Function);
+	bool IsBuilt() const { return bIsBuilt; }
+
+	// Parameters in stack order, excluding the return value.
+	TArray<FCSParameterMarshallingEntry> Parameters;
+
+	// Indices into Parameters for the values that have to be copied back to the caller.
+	TArray<int32> OutParameterIndices;
+
+	int32 StructureSize = 0;
+
+	// False if every parameter is zero constructed, so the buffer can just be zeroed.
+	bool bRequiresInitialization = false;
+
+	// False if no parameter needs its destructor called.
+	bool bRequiresDestruction = false;
+
+private:
+	bool bIsBuilt = false;
+};
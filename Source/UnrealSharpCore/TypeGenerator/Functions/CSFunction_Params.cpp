@@ -3,89 +3,100 @@
 void UCSFunction_Params::InvokeManagedMethod_Params(UObject* ObjectToInvokeOn, FFrame& Stack, RESULT_DECL)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunction_Params::InvokeManagedMethod_Params);
-	
-	UFunction* Function = Stack.CurrentNativeFunction;
-	FOutParmRec* OutParameters = nullptr;
-	FOutParmRec** LastOut = &OutParameters;
-	uint8* ArgumentBuffer = Stack.Locals;
-	uint8* LocalsCache = Stack.Locals;
 
-	// If we're calling this from BP, we need to copy the parameters to a new buffer
-	if (Stack.Code)
+	// Called from native code, the parameters are already laid out in Stack.Locals.
+	if (!Stack.Code)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunction_Params::InvokeManagedMethod_Params::CopyParametersToBuffer);
-		
-		int LocalStructSize = Function->GetStructureSize();
-		TArrayView<uint8> ArgumentData((uint8*)FMemory_Alloca(FMath::Max<int32>(1, LocalStructSize)), LocalStructSize);
-		ArgumentBuffer = ArgumentData.GetData();
-		Function->InitializeStruct(ArgumentBuffer);
-	
-		for (TFieldIterator<FProperty> ParamIt(Function, EFieldIteratorFlags::ExcludeSuper); ParamIt; ++ParamIt)
-		{
-			FProperty* FunctionParameter = *ParamIt;
+		InvokeManagedMethod(ObjectToInvokeOn, Stack, RESULT_PARAM);
 
-			if (FunctionParameter->HasAnyPropertyFlags(CPF_ReturnParm))
+		for (FOutParmRec* OutParameter = Stack.OutParms; OutParameter != nullptr; OutParameter = OutParameter->NextOutParm)
+		{
+			// The return value should already have been set
+			if (OutParameter->Property->HasAnyPropertyFlags(CPF_ReturnParm))
 			{
 				continue;
 			}
 
+			const uint8* ValueAddress = Stack.Locals + OutParameter->Property->GetOffset_ForUFunction();
+			OutParameter->Property->CopyCompleteValue(OutParameter->PropAddr, ValueAddress);
+		}
+
+		return;
+	}
+
+	// If we're calling this from BP, we need to copy the parameters to a new buffer
+	UCSFunctionBase* Function = static_cast<UCSFunctionBase*>(Stack.CurrentNativeFunction);
+	const FCSFunctionMarshallingPlan& Plan = Function->GetMarshallingPlan();
+	
+	uint8* LocalsCache = Stack.Locals;
+	uint8* ArgumentBuffer = static_cast<uint8*>(FMemory_Alloca(FMath::Max<int32>(1, Plan.StructureSize)));
+	uint8** OutParameterAddresses = static_cast<uint8**>(FMemory_Alloca(FMath::Max<int32>(1, Plan.OutParameterIndices.Num()) * sizeof(uint8*)));
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UCSFunction_Params::InvokeManagedMethod_Params::CopyParametersToBuffer);
+
+		if (Plan.bRequiresInitialization)
+		{
+			Function->InitializeStruct(ArgumentBuffer);
+		}
+		else
+		{
+			FMemory::Memzero(ArgumentBuffer, Plan.StructureSize);
+		}
+
+		for (const FCSParameterMarshallingEntry& Parameter : Plan.Parameters)
+		{
 			Stack.MostRecentPropertyAddress = nullptr;
 			Stack.MostRecentPropertyContainer = nullptr;
-			uint8* LocalValue = FunctionParameter->ContainerPtrToValuePtr<uint8>(ArgumentData.GetData());
-			Stack.StepCompiledIn(LocalValue, FunctionParameter->GetClass());
-		
+			uint8* LocalValue = ArgumentBuffer + Parameter.Offset;
+			Stack.StepCompiledIn(LocalValue, Parameter.PropertyClass);
+
 			uint8* ValueAddress = LocalValue;
-			if (FunctionParameter->HasAnyPropertyFlags(CPF_OutParm) && Stack.MostRecentPropertyContainer)
+			if (Parameter.bIsReference && Stack.MostRecentPropertyContainer)
 			{
 				ValueAddress = Stack.MostRecentPropertyContainer;
 			}
 
-			// Add any output parameters to the output params chain
-			if (IsOutParameter(FunctionParameter))
+			if (Parameter.OutParameterIndex != INDEX_NONE)
 			{
-				FOutParmRec* Out = static_cast<FOutParmRec*>(FMemory_Alloca(sizeof(FOutParmRec)));
-				Out->Property = FunctionParameter;
-				Out->PropAddr = ValueAddress;
-				Out->NextOutParm = nullptr;
-
-				// Link it to the end of the list
-				if (*LastOut)
-				{
-					(*LastOut)->NextOutParm = Out;
-					LastOut = &(*LastOut)->NextOutParm;
-				}
-				else
-				{
-					*LastOut = Out;
-				}
+				OutParameterAddresses[Parameter.OutParameterIndex] = ValueAddress;
 			}
-			
-			FunctionParameter->CopyCompleteValue(ArgumentData.GetData() + FunctionParameter->GetOffset_ForInternal(), ValueAddress);
-		}
 
-		Stack.Locals = ArgumentBuffer;
-	}
-	else
-	{
-		OutParameters = Stack.OutParms;
+			if (ValueAddress == LocalValue)
+			{
+				continue;
+			}
+
+			if (Parameter.bIsPlainOldData)
+			{
+				FMemory::Memcpy(LocalValue, ValueAddress, Parameter.Size);
+			}
+			else
+			{
+				Parameter.Property->CopyCompleteValue(LocalValue, ValueAddress);
+			}
+		}
 	}
-	
+
+	Stack.Locals = ArgumentBuffer;
 	InvokeManagedMethod(ObjectToInvokeOn, Stack, RESULT_PARAM);
-	
-	for (FOutParmRec* OutParameter = OutParameters; OutParameter != nullptr; OutParameter = OutParameter->NextOutParm)
+
+	for (int32 OutIndex = 0; OutIndex < Plan.OutParameterIndices.Num(); ++OutIndex)
 	{
-	    // The return value should already have been set
-	    if (OutParameter->Property->HasAnyPropertyFlags(CPF_ReturnParm))
-	    {
-		    continue;
-	    }
-	    
-		const uint8* ValueAddress = ArgumentBuffer + OutParameter->Property->GetOffset_ForUFunction();
-		OutParameter->Property->CopyCompleteValue(OutParameter->PropAddr, ValueAddress);
+		const FCSParameterMarshallingEntry& Parameter = Plan.Parameters[Plan.OutParameterIndices[OutIndex]];
+		const uint8* ValueAddress = ArgumentBuffer + Parameter.Offset;
+
+		if (Parameter.bIsPlainOldData)
+		{
+			FMemory::Memcpy(OutParameterAddresses[OutIndex], ValueAddress, Parameter.Size);
+		}
+		else
+		{
+			Parameter.Property->CopyCompleteValue(OutParameterAddresses[OutIndex], ValueAddress);
+		}
 	}
 
-	// Only free up the buffer if we're calling from BP
-	if (Stack.Code)
+	if (Plan.bRequiresDestruction)
 	{
 		Function->DestroyStruct(ArgumentBuffer);
 	}
@@ -0,0 +1,182 @@
+#include "CSBinaryMetaDataReader.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+FCSBinaryMetaDataReader::FCSBinaryMetaDataReader() = default;
+FCSBinaryMetaDataReader::~FCSBinaryMetaDataReader() = default;
+
+bool FCSBinaryMetaDataReader::OpenFile(const FString& FilePath)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBinaryMetaDataReader::OpenFile);
+
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	if (MappedFile.IsValid() && MappedFile->GetFileSize() > 0 && MappedFile->GetFileSize() <= MAX_int32)
+	{
+		MappedRegion.Reset(MappedFile->MapRegion());
+		if (MappedRegion.IsValid())
+		{
+			Data = TConstArrayView<uint8>(MappedRegion->GetMappedPtr(), static_cast<int32>(MappedRegion->GetMappedSize()));
+			return Validate();
+		}
+	}
+
+	MappedRegion.Reset();
+	MappedFile.Reset();
+
+	if (!FFileHelper::LoadFileToArray(LoadedData, *FilePath))
+	{
+		return false;
+	}
+
+	Data = LoadedData;
+	return Validate();
+}
+
+bool FCSBinaryMetaDataReader::FindMember(uint32 ObjectNode, const TCHAR* Key, uint32& OutValueNode) const
+{
+	const int32 NumMembers = Num(ObjectNode);
+	for (int32 Index = 0; Index < NumMembers; ++Index)
+	{
+		if (GetMemberKey(ObjectNode, Index).Equals(Key))
+		{
+			OutValueNode = GetMemberValue(ObjectNode, Index);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FCSBinaryMetaDataReader::Validate()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBinaryMetaDataReader::Validate);
+
+	const int64 Size = Data.Num();
+	int64 Position = 0;
+
+	auto Read = [this, Size, &Position](uint32& OutValue)
+	{
+		if (Position + 4 > Size)
+		{
+			return false;
+		}
+
+		OutValue = ReadUInt32(Position);
+		Position += 4;
+		return true;
+	};
+
+	uint32 FileMagic, FileVersion, NumStrings;
+	if (!Read(FileMagic) || FileMagic != Magic
+		|| !Read(FileVersion) || FileVersion != Version
+		|| !Read(NumStrings) || !Read(NumNodes) || !Read(RootNode))
+	{
+		return false;
+	}
+
+	// Every string takes at least its length prefix, so this also guards the reservation against garbage counts.
+	if (NumStrings > (Size - Position) / 4)
+	{
+		return false;
+	}
+
+	Strings.Reset(NumStrings);
+	for (uint32 Index = 0; Index < NumStrings; ++Index)
+	{
+		uint32 ByteLength;
+		if (!Read(ByteLength) || ByteLength > Size - Position)
+		{
+			return false;
+		}
+
+		FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data.GetData() + Position), ByteLength);
+		Strings.Emplace(Converted.Length(), Converted.Get());
+		Position += ByteLength;
+	}
+
+	if (NumNodes == 0 || NumNodes > (Size - Position) / 4 || RootNode >= NumNodes)
+	{
+		return false;
+	}
+
+	NodeOffsetsStart = Position;
+	NodeDataStart = Position + static_cast<int64>(NumNodes) * 4;
+
+	// The weaver writes children before their parents, so only accepting references to earlier nodes also rules out cycles.
+	for (uint32 Node = 0; Node < NumNodes; ++Node)
+	{
+		const int64 NodeOffset = GetNodeOffset(Node);
+		if (NodeOffset >= Size)
+		{
+			return false;
+		}
+
+		const int64 PayloadOffset = NodeOffset + 1;
+		const int64 PayloadSize = Size - PayloadOffset;
+
+		switch (static_cast<ENodeKind>(Data[NodeOffset]))
+		{
+		case ENodeKind::Null:
+		case ENodeKind::False:
+		case ENodeKind::True:
+			break;
+		case ENodeKind::Number:
+		case ENodeKind::String:
+			if (PayloadSize < 4 || ReadUInt32(PayloadOffset) >= NumStrings)
+			{
+				return false;
+			}
+			break;
+		case ENodeKind::Array:
+		{
+			if (PayloadSize < 4)
+			{
+				return false;
+			}
+
+			const uint32 NumElements = ReadUInt32(PayloadOffset);
+			if (NumElements > (PayloadSize - 4) / 4)
+			{
+				return false;
+			}
+
+			for (uint32 Index = 0; Index < NumElements; ++Index)
+			{
+				if (ReadUInt32(PayloadOffset + 4 + Index * 4) >= Node)
+				{
+					return false;
+				}
+			}
+			break;
+		}
+		case ENodeKind::Object:
+		{
+			if (PayloadSize < 4)
+			{
+				return false;
+			}
+
+			const uint32 NumMembers = ReadUInt32(PayloadOffset);
+			if (NumMembers > (PayloadSize - 4) / 8)
+			{
+				return false;
+			}
+
+			for (uint32 Index = 0; Index < NumMembers; ++Index)
+			{
+				const int64 MemberOffset = PayloadOffset + 4 + Index * 8;
+				if (ReadUInt32(MemberOffset) >= NumStrings || ReadUInt32(MemberOffset + 4) >= Node)
+				{
+					return false;
+				}
+			}
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+
+	return GetKind(RootNode) == ENodeKind::Object;
+}
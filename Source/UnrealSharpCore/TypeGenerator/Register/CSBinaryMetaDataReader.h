@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Reads the binary metadata file written by the weaver next to the JSON metadata (<Assembly>.metadata.bin).
+ * The file stores the same document as the JSON file, with an interned string table and a flat node table.
+ * The file is validated once when it's opened, after which the nodes are read in place through FCSMetaDataValue.
+ * See BinaryMetaDataWriter.cs for the layout.
+ */
+class FCSBinaryMetaDataReader
+{
+public:
+	UE_NONCOPYABLE(FCSBinaryMetaDataReader);
+
+	static constexpr uint32 Magic = 0x444D5355; // "USMD"
+	static constexpr uint32 Version = 1;
+
+	enum class ENodeKind : uint8
+	{
+		Null = 0,
+		False = 1,
+		True = 2,
+		Number = 3,
+		String = 4,
+		Array = 5,
+		Object = 6,
+	};
+
+	FCSBinaryMetaDataReader();
+	~FCSBinaryMetaDataReader();
+
+	// Memory-maps the file, or reads it into memory if it can't be mapped. Returns false if the file is not a supported binary metadata file or is corrupt.
+	bool OpenFile(const FString& FilePath);
+
+	uint32 GetRootNode() const { return RootNode; }
+	ENodeKind GetKind(uint32 Node) const { return static_cast<ENodeKind>(Data[GetNodeOffset(Node)]); }
+
+	// The value of a string node, or the literal of a number node.
+	const FString& GetString(uint32 Node) const { return Strings[ReadUInt32(GetNodeOffset(Node) + 1)]; }
+
+	// The number of elements of an array node, or members of an object node.
+	int32 Num(uint32 Node) const { return static_cast<int32>(ReadUInt32(GetNodeOffset(Node) + 1)); }
+
+	uint32 GetElement(uint32 ArrayNode, int32 Index) const { return ReadUInt32(GetNodeOffset(ArrayNode) + 5 + Index * 4); }
+	const FString& GetMemberKey(uint32 ObjectNode, int32 Index) const { return Strings[ReadUInt32(GetNodeOffset(ObjectNode) + 5 + Index * 8)]; }
+	uint32 GetMemberValue(uint32 ObjectNode, int32 Index) const { return ReadUInt32(GetNodeOffset(ObjectNode) + 9 + Index * 8); }
+
+	// Returns false if the object node has no member with the key.
+	bool FindMember(uint32 ObjectNode, const TCHAR* Key, uint32& OutValueNode) const;
+
+private:
+
+	// Checks the header, the string table and every node, so the accessors don't have to bounds check.
+	bool Validate();
+
+	// The string table has variable length, so the node data isn't necessarily aligned.
+	uint32 ReadUInt32(int64 Offset) const
+	{
+		uint32 Value;
+		FMemory::Memcpy(&Value, Data.GetData() + Offset, sizeof(Value));
+		return Value;
+	}
+
+	int64 GetNodeOffset(uint32 Node) const
+	{
+		return NodeDataStart + ReadUInt32(NodeOffsetsStart + static_cast<int64>(Node) * 4);
+	}
+
+	// Declared in this order so the region is released before the file handle.
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> LoadedData;
+
+	TConstArrayView<uint8> Data;
+	TArray<FString> Strings;
+
+	int64 NodeOffsetsStart = 0;
+	int64 NodeDataStart = 0;
+	uint32 NumNodes = 0;
+	uint32 RootNode = 0;
+};
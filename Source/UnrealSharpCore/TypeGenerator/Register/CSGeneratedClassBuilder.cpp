@@ -43,6 +43,7 @@ void UCSGeneratedClassBuilder::RebuildType(UField* TypeToBuild, const TSharedPtr
 
 	// Reset for each rebuild of the class, so it doesn't accumulate properties from previous builds.
 	Field->NumReplicatedProperties = 0;
+	Field->SetManagedObjectPoolSize(TypeMetaData->ManagedObjectPoolSize);
 	
 #if WITH_EDITOR
 	if (FCSUnrealSharpUtils::IsStandalonePIE())
@@ -143,32 +144,18 @@ UClass* UCSGeneratedClassBuilder::GetFieldType() const
 void UCSGeneratedClassBuilder::ManagedObjectConstructor(const FObjectInitializer& ObjectInitializer)
 {
 	UCSClass* FirstManagedClass = FCSClassUtilities::GetFirstManagedClass(ObjectInitializer.GetClass());
-	UClass* FirstNativeClass = FCSClassUtilities::GetFirstNativeClass(FirstManagedClass);
+	UObject* Object = ObjectInitializer.GetObj();
 	
 	//Execute the native class' constructor first.
-	FirstNativeClass->ClassConstructor(ObjectInitializer);
+	FirstManagedClass->GetFirstNativeClass()->ClassConstructor(ObjectInitializer);
 
 	// Initialize managed properties that are not zero initialized such as FText.
-	for (TFieldIterator<FProperty> PropertyIt(FirstManagedClass); PropertyIt; ++PropertyIt)
+	for (const FCSPropertyInitializer& Initializer : FirstManagedClass->GetPropertyInitializers())
 	{
-		FProperty* Property = *PropertyIt;
-
-		if (!FCSClassUtilities::IsManagedClass(Property->GetOwnerClass()))
-		{
-			// We don't want to initialize properties that are not from a managed class
-			break;
-		}
-		
-		if (Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
-		{
-			continue;
-		}
-
-		Property->InitializeValue_InContainer(ObjectInitializer.GetObj());
+		Initializer.Property->InitializeValue(reinterpret_cast<uint8*>(Object) + Initializer.Offset);
 	}
 
-	UCSAssembly* Assembly = FirstManagedClass->GetManagedTypeInfo<FCSClassInfo>()->GetOwningAssembly();
-	Assembly->CreateManagedObject(ObjectInitializer.GetObj());
+	FirstManagedClass->GetOwningAssembly()->CreateManagedObject(Object);
 }
 
 void UCSGeneratedClassBuilder::SetupDefaultTickSettings(UObject* DefaultObject, const UClass* Class)
@@ -0,0 +1,195 @@
+#include "CSMetaDataDocument.h"
+#include "CSBinaryMetaDataReader.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	using ENodeKind = FCSBinaryMetaDataReader::ENodeKind;
+
+	// Null values are treated as missing, like the JSON TryGet* accessors do.
+	FCSMetaDataValue MakeValue(const FCSBinaryMetaDataReader& Reader, uint32 Node)
+	{
+		return Reader.GetKind(Node) != ENodeKind::Null ? FCSMetaDataValue(Reader, Node) : FCSMetaDataValue();
+	}
+
+	FCSMetaDataValue MakeValue(const TSharedPtr<FJsonValue>& JsonValue)
+	{
+		return JsonValue.IsValid() && !JsonValue->IsNull() ? FCSMetaDataValue(*JsonValue) : FCSMetaDataValue();
+	}
+}
+
+bool FCSMetaDataValue::TryGetString(FString& OutValue) const
+{
+	if (Reader)
+	{
+		const ENodeKind Kind = Reader->GetKind(Node);
+		if (Kind != ENodeKind::String && Kind != ENodeKind::Number)
+		{
+			return false;
+		}
+
+		OutValue = Reader->GetString(Node);
+		return true;
+	}
+
+	return JsonValue && JsonValue->TryGetString(OutValue);
+}
+
+bool FCSMetaDataValue::TryGetBool(bool& OutValue) const
+{
+	if (Reader)
+	{
+		const ENodeKind Kind = Reader->GetKind(Node);
+		if (Kind != ENodeKind::True && Kind != ENodeKind::False)
+		{
+			return false;
+		}
+
+		OutValue = Kind == ENodeKind::True;
+		return true;
+	}
+
+	return JsonValue && JsonValue->TryGetBool(OutValue);
+}
+
+bool FCSMetaDataValue::TryGetNumber(int32& OutValue) const
+{
+	if (Reader)
+	{
+		const ENodeKind Kind = Reader->GetKind(Node);
+		return (Kind == ENodeKind::Number || Kind == ENodeKind::String) && LexTryParseString(OutValue, *Reader->GetString(Node));
+	}
+
+	return JsonValue && JsonValue->TryGetNumber(OutValue);
+}
+
+FString FCSMetaDataValue::AsString() const
+{
+	FString Value;
+	TryGetString(Value);
+	return Value;
+}
+
+int32 FCSMetaDataValue::Num() const
+{
+	if (Reader)
+	{
+		return Reader->GetKind(Node) == ENodeKind::Array ? Reader->Num(Node) : 0;
+	}
+
+	return JsonValue && JsonValue->Type == EJson::Array ? JsonValue->AsArray().Num() : 0;
+}
+
+FCSMetaDataValue FCSMetaDataValue::operator[](int32 Index) const
+{
+	check(Index >= 0 && Index < Num());
+
+	if (Reader)
+	{
+		return MakeValue(*Reader, Reader->GetElement(Node, Index));
+	}
+
+	return MakeValue(JsonValue->AsArray()[Index]);
+}
+
+FCSMetaDataValue FCSMetaDataValue::GetField(const TCHAR* FieldName) const
+{
+	if (Reader)
+	{
+		uint32 FieldNode;
+		if (Reader->GetKind(Node) != ENodeKind::Object || !Reader->FindMember(Node, FieldName, FieldNode))
+		{
+			return FCSMetaDataValue();
+		}
+
+		return MakeValue(*Reader, FieldNode);
+	}
+
+	if (!JsonValue || JsonValue->Type != EJson::Object)
+	{
+		return FCSMetaDataValue();
+	}
+
+	const TSharedPtr<FJsonValue>* FieldValue = JsonValue->AsObject()->Values.Find(FieldName);
+	return FieldValue ? MakeValue(*FieldValue) : FCSMetaDataValue();
+}
+
+void FCSMetaDataValue::ForEachField(TFunctionRef<void(const FString& FieldName, const FCSMetaDataValue& FieldValue)> Callback) const
+{
+	if (Reader)
+	{
+		if (Reader->GetKind(Node) != ENodeKind::Object)
+		{
+			return;
+		}
+
+		const int32 NumMembers = Reader->Num(Node);
+		for (int32 Index = 0; Index < NumMembers; ++Index)
+		{
+			Callback(Reader->GetMemberKey(Node, Index), MakeValue(*Reader, Reader->GetMemberValue(Node, Index)));
+		}
+
+		return;
+	}
+
+	if (!JsonValue || JsonValue->Type != EJson::Object)
+	{
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : JsonValue->AsObject()->Values)
+	{
+		Callback(Pair.Key, MakeValue(Pair.Value));
+	}
+}
+
+FCSMetaDataDocument::FCSMetaDataDocument() = default;
+FCSMetaDataDocument::~FCSMetaDataDocument() = default;
+
+bool FCSMetaDataDocument::LoadBinaryFile(const FString& FilePath)
+{
+	TUniquePtr<FCSBinaryMetaDataReader> NewReader = MakeUnique<FCSBinaryMetaDataReader>();
+	if (!NewReader->OpenFile(FilePath))
+	{
+		return false;
+	}
+
+	BinaryReader = MoveTemp(NewReader);
+	JsonRoot.Reset();
+	return true;
+}
+
+bool FCSMetaDataDocument::LoadJsonFile(const FString& FilePath)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSMetaDataDocument::LoadJsonFile);
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonValue> NewRoot;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), NewRoot) || !NewRoot.IsValid() || NewRoot->Type != EJson::Object)
+	{
+		return false;
+	}
+
+	JsonRoot = MoveTemp(NewRoot);
+	BinaryReader.Reset();
+	return true;
+}
+
+FCSMetaDataValue FCSMetaDataDocument::GetRoot() const
+{
+	if (BinaryReader.IsValid())
+	{
+		return FCSMetaDataValue(*BinaryReader, BinaryReader->GetRootNode());
+	}
+
+	return JsonRoot.IsValid() ? FCSMetaDataValue(*JsonRoot) : FCSMetaDataValue();
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FCSBinaryMetaDataReader;
+class FJsonValue;
+
+/**
+ * Read-only view of a value in the type metadata written by the weaver. Points either at a node of the binary metadata,
+ * or at a value of the JSON metadata, so the metadata types have a single read path for both files.
+ * The view doesn't own anything, the FCSMetaDataDocument it came from has to outlive it.
+ * Reading a missing field, or a field of a missing object, returns a default value like the JSON accessors do.
+ */
+class FCSMetaDataValue
+{
+public:
+	FCSMetaDataValue() = default;
+	FCSMetaDataValue(const FCSBinaryMetaDataReader& InReader, uint32 InNode) : Reader(&InReader), Node(InNode) {}
+	explicit FCSMetaDataValue(const FJsonValue& InJsonValue) : JsonValue(&InJsonValue) {}
+
+	// False for missing and null values.
+	bool IsValid() const { return Reader != nullptr || JsonValue != nullptr; }
+
+	bool TryGetString(FString& OutValue) const;
+	bool TryGetBool(bool& OutValue) const;
+	bool TryGetNumber(int32& OutValue) const;
+	FString AsString() const;
+
+	// Array values.
+	int32 Num() const;
+	FCSMetaDataValue operator[](int32 Index) const;
+
+	// Object values.
+	FCSMetaDataValue GetField(const TCHAR* FieldName) const;
+	void ForEachField(TFunctionRef<void(const FString& FieldName, const FCSMetaDataValue& FieldValue)> Callback) const;
+
+	bool TryGetStringField(const TCHAR* FieldName, FString& OutValue) const { return GetField(FieldName).TryGetString(OutValue); }
+	bool TryGetBoolField(const TCHAR* FieldName, bool& OutValue) const { return GetField(FieldName).TryGetBool(OutValue); }
+	bool TryGetNumberField(const TCHAR* FieldName, int32& OutValue) const { return GetField(FieldName).TryGetNumber(OutValue); }
+	FString GetStringField(const TCHAR* FieldName) const { return GetField(FieldName).AsString(); }
+
+	int32 GetIntegerField(const TCHAR* FieldName) const
+	{
+		int32 Value = 0;
+		TryGetNumberField(FieldName, Value);
+		return Value;
+	}
+
+	bool TryGetField(const TCHAR* FieldName, FCSMetaDataValue& OutValue) const
+	{
+		OutValue = GetField(FieldName);
+		return OutValue.IsValid();
+	}
+
+private:
+	const FCSBinaryMetaDataReader* Reader = nullptr;
+	uint32 Node = 0;
+
+	const FJsonValue* JsonValue = nullptr;
+};
+
+/**
+ * The type metadata of an assembly, loaded from <Assembly>.metadata.bin, or from <Assembly>.metadata.json when there's no up-to-date binary file.
+ * The binary file is read in place, only the JSON file is parsed into a DOM.
+ */
+class FCSMetaDataDocument
+{
+public:
+	UE_NONCOPYABLE(FCSMetaDataDocument);
+
+	FCSMetaDataDocument();
+	~FCSMetaDataDocument();
+
+	bool LoadBinaryFile(const FString& FilePath);
+	bool LoadJsonFile(const FString& FilePath);
+
+	bool IsBinary() const { return BinaryReader.IsValid(); }
+	FCSMetaDataValue GetRoot() const;
+
+private:
+	TUniquePtr<FCSBinaryMetaDataReader> BinaryReader;
+	TSharedPtr<FJsonValue> JsonRoot;
+};
@@ -2,38 +2,37 @@
 
 #include "CSFieldName.h"
 #include "CSUnrealSharpSettings.h"
-#include "Dom/JsonObject.h"
 #include "TypeGenerator/Factories/CSPropertyFactory.h"
 #include "UObject/UnrealType.h"
 
-void FCSMetaDataUtils::SerializeFunctions(const TArray<TSharedPtr<FJsonValue>>& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData)
+void FCSMetaDataUtils::SerializeFunctions(const FCSMetaDataValue& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData)
 {
 	FunctionMetaData.Reserve(FunctionsInfo.Num());
 	
-	for (const TSharedPtr<FJsonValue>& FunctionInfo : FunctionsInfo)
+	for (int32 Index = 0; Index < FunctionsInfo.Num(); ++Index)
 	{
 		FCSFunctionMetaData NewFunctionMetaData;
-		NewFunctionMetaData.SerializeFromJson(FunctionInfo->AsObject());
+		NewFunctionMetaData.Serialize(FunctionsInfo[Index]);
 		FunctionMetaData.Emplace(MoveTemp(NewFunctionMetaData));
 	}
 }
 
-void FCSMetaDataUtils::SerializeProperties(const TArray<TSharedPtr<FJsonValue>>& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags)
+void FCSMetaDataUtils::SerializeProperties(const FCSMetaDataValue& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags)
 {
 	PropertiesMetaData.Reserve(PropertiesInfo.Num());
 	
-	for (const TSharedPtr<FJsonValue>& Property : PropertiesInfo)
+	for (int32 Index = 0; Index < PropertiesInfo.Num(); ++Index)
 	{
 		FCSPropertyMetaData NewPropertyMetaData;
-		SerializeProperty(Property->AsObject(), NewPropertyMetaData, DefaultFlags);
+		SerializeProperty(PropertiesInfo[Index], NewPropertyMetaData, DefaultFlags);
 		PropertiesMetaData.Emplace(MoveTemp(NewPropertyMetaData));
 	}
 }
 
-void FCSMetaDataUtils::SerializeProperty(const TSharedPtr<FJsonObject>& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags)
+void FCSMetaDataUtils::SerializeProperty(const FCSMetaDataValue& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags)
 {
 	PropertiesMetaData.Type = FCSPropertyFactory::CreateTypeMetaData(PropertyMetaData);
-	PropertiesMetaData.SerializeFromJson(PropertyMetaData);
+	PropertiesMetaData.Serialize(PropertyMetaData);
 }
 
 FString FCSMetaDataUtils::GetAdjustedFieldName(const FCSFieldName& FieldName)
@@ -54,22 +53,12 @@ FString FCSMetaDataUtils::GetAdjustedFieldName(const FCSFieldName& FieldName)
 	return *Name;
 }
 
-void FCSMetaDataUtils::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject, TMap<FString, FString>& MetaDataMap)
+void FCSMetaDataUtils::SerializeMetaData(const FCSMetaDataValue& Value, TMap<FString, FString>& MetaDataMap)
 {
-	const TSharedPtr<FJsonObject>* MetaDataObjectPtr;
-	if (JsonObject->TryGetObjectField(TEXT("MetaData"), MetaDataObjectPtr))
+	Value.GetField(TEXT("MetaData")).ForEachField([&MetaDataMap](const FString& Key, const FCSMetaDataValue& MetaDataValue)
 	{
-		TSharedPtr<FJsonObject> MetaDataObject = *MetaDataObjectPtr;
-		for (const auto& Pair : MetaDataObject->Values)
-		{
-			FString Key = Pair.Key;
-			FString Value;
-			
-			MetaDataObject->TryGetStringField(Key, Value);
-
-			MetaDataMap.Add(Key, Value);
-		}
-	}
+		MetaDataMap.Add(Key, MetaDataValue.AsString());
+	});
 }
 
 void FCSMetaDataUtils::ApplyMetaData(const TMap<FString, FString>& MetaDataMap, UField* Field)
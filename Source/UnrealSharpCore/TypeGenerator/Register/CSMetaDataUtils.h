@@ -1,7 +1,7 @@
 ﻿#pragma once
 
 #include "CoreMinimal.h"
-#include "Dom/JsonObject.h"
+#include "CSMetaDataDocument.h"
 #include "MetaData/CSFunctionMetaData.h"
 #include "UObject/ObjectMacros.h"
 
@@ -9,15 +9,15 @@ struct FCSFieldName;
 
 namespace FCSMetaDataUtils
 {
-	void SerializeFunctions(const TArray<TSharedPtr<FJsonValue>>& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData);
-	void SerializeProperties(const TArray<TSharedPtr<FJsonValue>>& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
-	void SerializeProperty(const TSharedPtr<FJsonObject>& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
+	void SerializeFunctions(const FCSMetaDataValue& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData);
+	void SerializeProperties(const FCSMetaDataValue& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
+	void SerializeProperty(const FCSMetaDataValue& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
 
 	template<typename FlagType>
-	FlagType GetFlags(const TSharedPtr<FJsonObject>& PropertyInfo, const FString& StringField)
+	FlagType GetFlags(const FCSMetaDataValue& PropertyInfo, const TCHAR* StringField)
 	{
 		FString FoundStringField;
-		PropertyInfo->TryGetStringField(StringField, FoundStringField);
+		PropertyInfo.TryGetStringField(StringField, FoundStringField);
 
 		if (FoundStringField.IsEmpty())
 		{
@@ -29,7 +29,7 @@ namespace FCSMetaDataUtils
 		return static_cast<FlagType>(FunctionFlagsInt);
 	};
 	
-	void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject, TMap<FString, FString>& MetaDataMap);
+	void SerializeMetaData(const FCSMetaDataValue& Value, TMap<FString, FString>& MetaDataMap);
 	UNREALSHARPCORE_API void ApplyMetaData(const TMap<FString, FString>& MetaDataMap, UField* Field);
 	UNREALSHARPCORE_API void ApplyMetaData(const TMap<FString, FString>& MetaDataMap, FField* Field);
 
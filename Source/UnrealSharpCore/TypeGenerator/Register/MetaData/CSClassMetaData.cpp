@@ -2,48 +2,36 @@
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSClassMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSClassMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
+	FCSTypeReferenceMetaData::Serialize(Value);
 
-	ClassFlags = FCSMetaDataUtils::GetFlags<EClassFlags>(JsonObject,"ClassFlags");
+	ClassFlags = FCSMetaDataUtils::GetFlags<EClassFlags>(Value, TEXT("ClassFlags"));
 	
-	ParentClass.SerializeFromJson(JsonObject->GetObjectField(TEXT("ParentClass")));
+	ParentClass.Serialize(Value.GetField(TEXT("ParentClass")));
 
 	FString ClassConfigNameStr;
-	if (JsonObject->TryGetStringField(TEXT("ConfigCategory"), ClassConfigNameStr))
+	if (Value.TryGetStringField(TEXT("ConfigCategory"), ClassConfigNameStr))
 	{
 		ClassConfigName = *ClassConfigNameStr;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* FoundInterfaces;
-	if (JsonObject->TryGetArrayField(TEXT("Interfaces"), FoundInterfaces))
-	{
-		for (const TSharedPtr<FJsonValue>& Interface : *FoundInterfaces)
-		{
-			FCSTypeReferenceMetaData& InterfaceMetaData = Interfaces.AddDefaulted_GetRef();
-			InterfaceMetaData.SerializeFromJson(Interface->AsObject());
-		}
-	}
+	Value.TryGetNumberField(TEXT("ManagedObjectPoolSize"), ManagedObjectPoolSize);
 
-	const TArray<TSharedPtr<FJsonValue>>* FoundFunctions;
-	if (JsonObject->TryGetArrayField(TEXT("Functions"), FoundFunctions))
+	const FCSMetaDataValue FoundInterfaces = Value.GetField(TEXT("Interfaces"));
+	for (int32 Index = 0; Index < FoundInterfaces.Num(); ++Index)
 	{
-		FCSMetaDataUtils::SerializeFunctions(*FoundFunctions, Functions);
+		FCSTypeReferenceMetaData& InterfaceMetaData = Interfaces.AddDefaulted_GetRef();
+		InterfaceMetaData.Serialize(FoundInterfaces[Index]);
 	}
+
+	FCSMetaDataUtils::SerializeFunctions(Value.GetField(TEXT("Functions")), Functions);
 	
-	const TArray<TSharedPtr<FJsonValue>>* FoundVirtualFunctions;
-	if (JsonObject->TryGetArrayField(TEXT("VirtualFunctions"), FoundVirtualFunctions))
+	const FCSMetaDataValue FoundVirtualFunctions = Value.GetField(TEXT("VirtualFunctions"));
+	for (int32 Index = 0; Index < FoundVirtualFunctions.Num(); ++Index)
 	{
-		for (const TSharedPtr<FJsonValue>& VirtualFunction : *FoundVirtualFunctions)
-		{
-			VirtualFunctions.Add(*VirtualFunction->AsObject()->GetStringField(TEXT("Name")));
-		}
+		VirtualFunctions.Add(*FoundVirtualFunctions[Index].GetStringField(TEXT("Name")));
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>* FoundProperties;
-	if (JsonObject->TryGetArrayField(TEXT("Properties"), FoundProperties))
-	{
-		FCSMetaDataUtils::SerializeProperties(*FoundProperties, Properties);
-	}
+	FCSMetaDataUtils::SerializeProperties(Value.GetField(TEXT("Properties")), Properties);
 }
@@ -25,8 +25,11 @@ struct FCSClassMetaData : public FCSTypeReferenceMetaData
 
 	FName ClassConfigName;
 
+	// Max number of C# counterparts kept alive for reuse after their UObjects are destroyed. 0 disables pooling.
+	int32 ManagedObjectPoolSize = 0;
+
 	// FTypeReferenceMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void Serialize(const FCSMetaDataValue& Value) override;
 	// End of implementation
 	
 	bool operator==(const FCSClassMetaData& Other) const
@@ -44,6 +47,7 @@ struct FCSClassMetaData : public FCSTypeReferenceMetaData
 				bCanTick == Other.bCanTick &&
 				bOverrideInput == Other.bOverrideInput &&
 				ClassFlags == Other.ClassFlags &&
-				ClassConfigName == Other.ClassConfigName;
+				ClassConfigName == Other.ClassConfigName &&
+				ManagedObjectPoolSize == Other.ManagedObjectPoolSize;
 	}
 };
@@ -1,9 +1,10 @@
 ﻿#include "CSClassPropertyMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
-void FCSClassPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSClassPropertyMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSUnrealType::SerializeFromJson(JsonObject);
-	TypeRef.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
+	FCSUnrealType::Serialize(Value);
+	TypeRef.Serialize(Value.GetField(TEXT("InnerType")));
 }
 
 bool FCSClassPropertyMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
@@ -1,10 +1,10 @@
 ﻿#include "CSContainerBaseMetaData.h"
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSContainerBaseMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSContainerBaseMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSUnrealType::SerializeFromJson(JsonObject);
-	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("InnerProperty")), InnerProperty);
+	FCSUnrealType::Serialize(Value);
+	FCSMetaDataUtils::SerializeProperty(Value.GetField(TEXT("InnerProperty")), InnerProperty);
 }
 
 bool FCSContainerBaseMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
@@ -1,19 +1,20 @@
 ﻿#include "CSDefaultComponentMetaData.h"
 
 #include "UnrealSharpCore.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
 bool FCSDefaultComponentMetaData::HasValidAttachment() const
 {
 	return AttachmentComponent != NAME_None;
 }
 
-void FCSDefaultComponentMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSDefaultComponentMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSObjectMetaData::SerializeFromJson(JsonObject);
-	JsonObject->TryGetBoolField(TEXT("IsRootComponent"), IsRootComponent);
+	FCSObjectMetaData::Serialize(Value);
+	Value.TryGetBoolField(TEXT("IsRootComponent"), IsRootComponent);
 
 	FString AttachmentComponentStr;
-	if (JsonObject->TryGetStringField(TEXT("AttachmentComponent"), AttachmentComponentStr))
+	if (Value.TryGetStringField(TEXT("AttachmentComponent"), AttachmentComponentStr))
 	{
 		if (!AttachmentComponentStr.IsEmpty())
 		{
@@ -29,7 +30,7 @@ void FCSDefaultComponentMetaData::SerializeFromJson(const TSharedPtr<FJsonObject
 	}
 
 	FString AttachmentSocketStr;
-	if (JsonObject->TryGetStringField(TEXT("AttachmentSocket"), AttachmentSocketStr))
+	if (Value.TryGetStringField(TEXT("AttachmentSocket"), AttachmentSocketStr))
 	{
 		if (!AttachmentSocketStr.IsEmpty())
 		{
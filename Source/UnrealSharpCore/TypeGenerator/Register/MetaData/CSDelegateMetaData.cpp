@@ -1,8 +1,8 @@
 ﻿#include "CSDelegateMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
-void FCSDelegateMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSDelegateMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
-	TSharedPtr<FJsonObject> SignatureFunctionArray = JsonObject->GetObjectField(TEXT("Signature"));
-	SignatureFunction.SerializeFromJson(SignatureFunctionArray);
+	FCSTypeReferenceMetaData::Serialize(Value);
+	SignatureFunction.Serialize(Value.GetField(TEXT("Signature")));
 }
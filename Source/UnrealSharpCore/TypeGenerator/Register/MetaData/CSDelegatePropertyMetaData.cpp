@@ -1,11 +1,10 @@
 ﻿#include "CSDelegatePropertyMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
-void FCSDelegatePropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSDelegatePropertyMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSUnrealType::SerializeFromJson(JsonObject);
-
-	TSharedPtr<FJsonObject> DelegateObject = JsonObject->GetObjectField(TEXT("UnrealDelegateType"));
-	Delegate.SerializeFromJson(DelegateObject);
+	FCSUnrealType::Serialize(Value);
+	Delegate.Serialize(Value.GetField(TEXT("UnrealDelegateType")));
 }
 
 bool FCSDelegatePropertyMetaData::IsEqual(const TSharedPtr<FCSUnrealType> Other) const
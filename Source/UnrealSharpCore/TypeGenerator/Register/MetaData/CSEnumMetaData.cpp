@@ -1,15 +1,13 @@
 ﻿#include "CSEnumMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
-void FCSEnumMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSEnumMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
+	FCSTypeReferenceMetaData::Serialize(Value);
 
-	const TArray<TSharedPtr<FJsonValue>>* EnumValues;
-	if (JsonObject->TryGetArrayField(TEXT("Items"), EnumValues))
+	const FCSMetaDataValue EnumValues = Value.GetField(TEXT("Items"));
+	for (int32 Index = 0; Index < EnumValues.Num(); ++Index)
 	{
-		for (const TSharedPtr<FJsonValue>& Item : *EnumValues)
-		{
-			Items.Add(*Item->AsString());
-		}
+		Items.Add(*EnumValues[Index].AsString());
 	}
 }
\ No newline at end of file
@@ -9,7 +9,7 @@ struct FCSEnumMetaData : public FCSTypeReferenceMetaData
 	TArray<FName> Items;
 
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void Serialize(const FCSMetaDataValue& Value) override;
 	//End of implementation
 
 	bool operator ==(const FCSEnumMetaData& Other) const
@@ -1,9 +1,10 @@
 ﻿#include "CSEnumPropertyMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
-void FCSEnumPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSEnumPropertyMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSUnrealType::SerializeFromJson(JsonObject);
-	InnerProperty.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerProperty")));
+	FCSUnrealType::Serialize(Value);
+	InnerProperty.Serialize(Value.GetField(TEXT("InnerProperty")));
 }
 
 bool FCSEnumPropertyMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
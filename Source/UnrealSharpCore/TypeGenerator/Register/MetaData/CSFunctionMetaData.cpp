@@ -2,25 +2,21 @@
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSFunctionMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSFunctionMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSMemberMetaData::SerializeFromJson(JsonObject);
+	FCSMemberMetaData::Serialize(Value);
 
-	const TArray<TSharedPtr<FJsonValue>>* ParametersArrayField;
-	if (JsonObject->TryGetArrayField(TEXT("Parameters"), ParametersArrayField))
-	{
-		FCSMetaDataUtils::SerializeProperties(*ParametersArrayField, Parameters);
-	}
+	FCSMetaDataUtils::SerializeProperties(Value.GetField(TEXT("Parameters")), Parameters);
 
-	const TSharedPtr<FJsonObject>* ReturnValueObject;
-	if (JsonObject->TryGetObjectField(TEXT("ReturnValue"), ReturnValueObject))
+	FCSMetaDataValue ReturnValueObject;
+	if (Value.TryGetField(TEXT("ReturnValue"), ReturnValueObject))
 	{
-		FCSMetaDataUtils::SerializeProperty(*ReturnValueObject, ReturnValue);
+		FCSMetaDataUtils::SerializeProperty(ReturnValueObject, ReturnValue);
 		
 		//Since the return value has no name in the C# reflection. Just assign "ReturnValue" to it.
 		ReturnValue.Name = "ReturnValue";
 	}
 
-	JsonObject->TryGetBoolField(TEXT("IsVirtual"), IsVirtual);
-	FunctionFlags = FCSMetaDataUtils::GetFlags<EFunctionFlags>(JsonObject,"FunctionFlags");
+	Value.TryGetBoolField(TEXT("IsVirtual"), IsVirtual);
+	FunctionFlags = FCSMetaDataUtils::GetFlags<EFunctionFlags>(Value, TEXT("FunctionFlags"));
 }
@@ -13,7 +13,7 @@ struct FCSFunctionMetaData : FCSMemberMetaData
 	EFunctionFlags FunctionFlags;
 
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void Serialize(const FCSMetaDataValue& Value) override;
 	//End of implementation
 
 	bool HasReturnValue() const { return ReturnValue.Type != nullptr; }
@@ -2,9 +2,9 @@
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSInterfaceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSInterfaceMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
-	FCSMetaDataUtils::SerializeFunctions(JsonObject->GetArrayField(TEXT("Functions")), Functions);
-	ParentInterface.SerializeFromJson(JsonObject->GetObjectField(TEXT("ParentInterface")));
+	FCSTypeReferenceMetaData::Serialize(Value);
+	FCSMetaDataUtils::SerializeFunctions(Value.GetField(TEXT("Functions")), Functions);
+	ParentInterface.Serialize(Value.GetField(TEXT("ParentInterface")));
 }
@@ -11,7 +11,7 @@ struct FCSInterfaceMetaData : FCSTypeReferenceMetaData
 	TArray<FCSFunctionMetaData> Functions;
 	
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void Serialize(const FCSMetaDataValue& Value) override;
 	//End of implementation
 
 	bool operator ==(const FCSInterfaceMetaData& Other) const
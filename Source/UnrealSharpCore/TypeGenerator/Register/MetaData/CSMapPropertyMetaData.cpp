@@ -2,10 +2,10 @@
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSMapPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSMapPropertyMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSContainerBaseMetaData::SerializeFromJson(JsonObject);
-	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("ValueProperty")), ValueType);
+	FCSContainerBaseMetaData::Serialize(Value);
+	FCSMetaDataUtils::SerializeProperty(Value.GetField(TEXT("ValueProperty")), ValueType);
 }
 
 bool FCSMapPropertyMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
@@ -8,7 +8,7 @@ struct FCSMapPropertyMetaData : public FCSContainerBaseMetaData
 	FCSPropertyMetaData ValueType;
 
 	// FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void Serialize(const FCSMetaDataValue& Value) override;
 	virtual bool IsEqual(TSharedPtr<FCSUnrealType> Other) const override;
 	// End of implementation
 };
@@ -1,8 +1,8 @@
 ﻿#include "CSMemberMetaData.h"
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSMemberMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSMemberMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	Name = *JsonObject->GetStringField(TEXT("Name"));
-	FCSMetaDataUtils::SerializeFromJson(JsonObject, MetaData);
+	Name = *Value.GetStringField(TEXT("Name"));
+	FCSMetaDataUtils::SerializeMetaData(Value, MetaData);
 }
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+class FCSMetaDataValue;
+
 struct FCSMemberMetaData
 {
 	virtual ~FCSMemberMetaData() = default;
@@ -7,7 +9,7 @@ struct FCSMemberMetaData
 	FName Name;
 	TMap<FString, FString> MetaData;
 	
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	virtual void Serialize(const FCSMetaDataValue& Value);
 
 	bool HasMetaData(const FString& Key) const
 	{
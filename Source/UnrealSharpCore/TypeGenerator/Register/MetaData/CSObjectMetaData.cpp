@@ -1,9 +1,10 @@
 ﻿#include "CSObjectMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
-void FCSObjectMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSObjectMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSUnrealType::SerializeFromJson(JsonObject);
-	InnerType.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
+	FCSUnrealType::Serialize(Value);
+	InnerType.Serialize(Value.GetField(TEXT("InnerType")));
 }
 
 bool FCSObjectMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
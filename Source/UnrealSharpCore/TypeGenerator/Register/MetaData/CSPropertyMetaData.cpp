@@ -1,18 +1,18 @@
 ﻿#include "CSPropertyMetaData.h"
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
-void FCSPropertyMetaData:: SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSPropertyMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSMemberMetaData::SerializeFromJson(JsonObject);
+	FCSMemberMetaData::Serialize(Value);
 	
-	PropertyFlags = FCSMetaDataUtils::GetFlags<EPropertyFlags>(JsonObject,"PropertyFlags");
-	LifetimeCondition = FCSMetaDataUtils::GetFlags<ELifetimeCondition>(JsonObject,"LifetimeCondition");
+	PropertyFlags = FCSMetaDataUtils::GetFlags<EPropertyFlags>(Value, TEXT("PropertyFlags"));
+	LifetimeCondition = FCSMetaDataUtils::GetFlags<ELifetimeCondition>(Value, TEXT("LifetimeCondition"));
 	
-	JsonObject->TryGetStringField(TEXT("BlueprintGetter"), BlueprintGetter);
-	JsonObject->TryGetStringField(TEXT("BlueprintSetter"), BlueprintSetter);
+	Value.TryGetStringField(TEXT("BlueprintGetter"), BlueprintGetter);
+	Value.TryGetStringField(TEXT("BlueprintSetter"), BlueprintSetter);
 
 	FString RepNotifyFunctionNameStr;
-	if (JsonObject->TryGetStringField(TEXT("RepNotifyFunctionName"), RepNotifyFunctionNameStr))
+	if (Value.TryGetStringField(TEXT("RepNotifyFunctionName"), RepNotifyFunctionNameStr))
 	{
 		RepNotifyFunctionName = *RepNotifyFunctionNameStr;
 	}
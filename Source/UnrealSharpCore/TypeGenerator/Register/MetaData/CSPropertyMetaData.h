@@ -16,7 +16,7 @@ struct UNREALSHARPCORE_API FCSPropertyMetaData : FCSMemberMetaData
 	FString BlueprintGetter;
 
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void Serialize(const FCSMetaDataValue& Value) override;
 	//End of implementation
 
 	template<typename T>
@@ -1,11 +1,7 @@
 ﻿#include "CSStructMetaData.h"
 
-void FCSStructMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSStructMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
-	const TArray<TSharedPtr<FJsonValue>>* FoundProperties;
-	if (JsonObject->TryGetArrayField(TEXT("Fields"), FoundProperties))
-	{
-		FCSMetaDataUtils::SerializeProperties(*FoundProperties, Properties);
-	}
+	FCSTypeReferenceMetaData::Serialize(Value);
+	FCSMetaDataUtils::SerializeProperties(Value.GetField(TEXT("Fields")), Properties);
 }
\ No newline at end of file
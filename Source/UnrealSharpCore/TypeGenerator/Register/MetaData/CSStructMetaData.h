@@ -10,7 +10,7 @@ struct FCSStructMetaData : FCSTypeReferenceMetaData
 	TArray<FCSPropertyMetaData> Properties;
 
 	//FTypeMetaData interface implementation
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void Serialize(const FCSMetaDataValue& Value) override;
 	//End of implementation
 
 	bool operator ==(const FCSStructMetaData& Other) const
@@ -1,9 +1,10 @@
 ﻿#include "CSStructPropertyMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
-void FCSStructPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSStructPropertyMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FCSUnrealType::SerializeFromJson(JsonObject);
-	TypeRef.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
+	FCSUnrealType::Serialize(Value);
+	TypeRef.Serialize(Value.GetField(TEXT("InnerType")));
 }
 
 bool FCSStructPropertyMetaData::IsEqual(TSharedPtr<FCSUnrealType> Other) const
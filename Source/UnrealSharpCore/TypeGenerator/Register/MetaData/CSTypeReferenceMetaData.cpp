@@ -43,17 +43,17 @@ UPackage* FCSTypeReferenceMetaData::GetOwningPackage() const
 	return UCSManager::Get().GetPackage(FieldName.GetNamespace());
 }
 
-void FCSTypeReferenceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSTypeReferenceMetaData::Serialize(const FCSMetaDataValue& Value)
 {
-	FString TypeName = JsonObject->GetStringField(TEXT("Name"));
-	FString Namespace = JsonObject->GetStringField(TEXT("Namespace"));
+	FString TypeName = Value.GetStringField(TEXT("Name"));
+	FString Namespace = Value.GetStringField(TEXT("Namespace"));
 	FieldName = FCSFieldName(*TypeName, *Namespace);
 
 	FString AssemblyNameStr;
-	if (JsonObject->TryGetStringField(TEXT("AssemblyName"), AssemblyNameStr))
+	if (Value.TryGetStringField(TEXT("AssemblyName"), AssemblyNameStr))
 	{
 		AssemblyName = *AssemblyNameStr;
 	}
 	
-	FCSMetaDataUtils::SerializeFromJson(JsonObject, MetaData);
+	FCSMetaDataUtils::SerializeMetaData(Value, MetaData);
 }
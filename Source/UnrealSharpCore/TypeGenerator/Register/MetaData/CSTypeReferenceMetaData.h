@@ -3,6 +3,7 @@
 #include "CSFieldName.h"
 
 class UCSAssembly;
+class FCSMetaDataValue;
 
 struct FCSTypeReferenceMetaData
 {
@@ -24,7 +25,7 @@ struct FCSTypeReferenceMetaData
 
 	TMap<FString, FString> MetaData;
 	
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	virtual void Serialize(const FCSMetaDataValue& Value);
 
 	bool operator==(const FCSTypeReferenceMetaData& Other) const
 	{
@@ -1,8 +1,9 @@
 ﻿#include "CSUnrealType.h"
+#include "TypeGenerator/Register/CSMetaDataDocument.h"
 
-void FCSUnrealType::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
+void FCSUnrealType::Serialize(const FCSMetaDataValue& Value)
 {
-	PropertyType = static_cast<ECSPropertyType>(JsonObject->GetIntegerField(TEXT("PropertyType")));
+	PropertyType = static_cast<ECSPropertyType>(Value.GetIntegerField(TEXT("PropertyType")));
 }
 
 bool FCSUnrealType::IsEqual(const TSharedPtr<FCSUnrealType> Other) const
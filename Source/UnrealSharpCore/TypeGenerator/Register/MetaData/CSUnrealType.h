@@ -2,6 +2,8 @@
 
 #include "CSPropertyType.h"
 
+class FCSMetaDataValue;
+
 struct FCSUnrealType
 {
 	virtual ~FCSUnrealType() = default;
@@ -9,7 +11,7 @@ struct FCSUnrealType
 	ECSPropertyType PropertyType = ECSPropertyType::Unknown;
 
 	// Begin FCSUnrealType
-	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	virtual void Serialize(const FCSMetaDataValue& Value);
 	virtual bool IsEqual(TSharedPtr<FCSUnrealType> Other) const;
 	// End FCSUnrealType
 
@@ -50,6 +50,9 @@ struct UNREALSHARPCORE_API FCSManagedTypeInfo : TSharedFromThis<FCSManagedTypeIn
 
 	void SetTypeMetaData(const TSharedPtr<FCSTypeReferenceMetaData>& InTypeMetaData) { TypeMetaData = InTypeMetaData; }
 
+	void SetContentHash(uint64 NewContentHash) { ContentHash = NewContentHash; }
+	uint64 GetContentHash() const { return ContentHash; }
+
 	UClass* GetFieldClass() const { return FieldClass.Get(); }
 
 	bool IsNativeType() const { return !TypeMetaData.IsValid(); }
@@ -75,6 +78,9 @@ protected:
 	// Current state of the structure of this type. This changes when new UProperties/UFunctions/metadata are added or removed.
 	ECSStructureState StructureState = HasChangedStructure;
 
+	// Hash of the metadata this type was last registered with, as written by the weaver. Zero if unknown.
+	uint64 ContentHash = 0;
+
 	// Handle to the managed type in the C# assembly.
 	TSharedPtr<FGCHandle> ManagedTypeHandle;
 
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
 
 #if ENGINE_MINOR_VERSION >= 4
 #define CS_EInternalObjectFlags_AllFlags EInternalObjectFlags_AllFlags
@@ -10,6 +11,7 @@
 #endif
 
 DECLARE_LOG_CATEGORY_EXTERN(LogUnrealSharp, Log, All);
+DECLARE_STATS_GROUP(TEXT("UnrealSharp"), STATGROUP_UnrealSharp, STATCAT_Advanced);
 
 class FUnrealSharpCoreModule : public IModuleInterface
 {
@@ -0,0 +1,93 @@
+﻿#include "CSBackgroundBuild.h"
+#include "CSUnrealSharpEditorSettings.h"
+#include "UnrealSharpEditor.h"
+#include "Async/Async.h"
+#include "Logging/StructuredLog.h"
+#include "UnrealSharpProcHelper/CSProcHelper.h"
+
+void FCSBackgroundBuild::NotifySourceChanged()
+{
+	LastChangeTime = FPlatformTime::Seconds();
+	bHasPendingChanges = true;
+}
+
+void FCSBackgroundBuild::Tick(const FCSManagedUnrealSharpEditorCallbacks& Callbacks)
+{
+	if (BuildResult.IsValid())
+	{
+		// A newer save makes the build in flight obsolete.
+		if (bHasPendingChanges && !bCancelRequested)
+		{
+			UE_LOGFMT(LogUnrealSharpEditor, Log, "Scripts changed during the background build, restarting it.");
+			bCancelRequested = true;
+			Callbacks.CancelBuild();
+		}
+
+		if (!BuildResult.IsReady())
+		{
+			return;
+		}
+
+		FCSBackgroundBuildResult Result = BuildResult.Consume();
+		BuildResult.Reset();
+
+		if (bCancelRequested)
+		{
+			bCancelRequested = false;
+		}
+		else
+		{
+			OnBuildFinished.ExecuteIfBound(Result);
+		}
+	}
+
+	const UCSUnrealSharpEditorSettings* Settings = GetDefault<UCSUnrealSharpEditorSettings>();
+	if (bHasPendingChanges && FPlatformTime::Seconds() - LastChangeTime >= Settings->BackgroundBuildDelay)
+	{
+		StartBuild(Callbacks);
+	}
+}
+
+void FCSBackgroundBuild::CancelAndWait(const FCSManagedUnrealSharpEditorCallbacks& Callbacks)
+{
+	bHasPendingChanges = false;
+
+	if (!BuildResult.IsValid())
+	{
+		return;
+	}
+
+	Callbacks.CancelBuild();
+	BuildResult.Wait();
+	BuildResult.Reset();
+	bCancelRequested = false;
+}
+
+void FCSBackgroundBuild::StartBuild(const FCSManagedUnrealSharpEditorCallbacks& Callbacks)
+{
+	const UCSUnrealSharpEditorSettings* Settings = GetDefault<UCSUnrealSharpEditorSettings>();
+
+	FString SolutionPath = FCSProcHelper::GetPathToSolution();
+	FString OutputPath = FCSProcHelper::GetUserAssemblyDirectory();
+	FString BuildConfiguration = Settings->GetBuildConfigurationString();
+	ECSLoggerVerbosity LogVerbosity = Settings->LogVerbosity;
+	FCSManagedUnrealSharpEditorCallbacks::FBuildProject Build = Callbacks.Build;
+	const double ChangeTime = LastChangeTime;
+
+	bHasPendingChanges = false;
+	UE_LOGFMT(LogUnrealSharpEditor, Log, "Starting background build.");
+
+	// Reset here rather than on the worker, where it could clear a cancel sent before the build got going.
+	Callbacks.ResetCancelBuild();
+
+	BuildResult = Async(EAsyncExecution::Thread, [=]() -> FCSBackgroundBuildResult
+	{
+		FCSBackgroundBuildResult Result;
+		Result.LastChangeTime = ChangeTime;
+
+		const double StartTime = FPlatformTime::Seconds();
+		Result.bSucceeded = Build(*SolutionPath, *OutputPath, *BuildConfiguration, LogVerbosity, &Result.ErrorMessage, true);
+		Result.BuildSeconds = FPlatformTime::Seconds() - StartTime;
+		return Result;
+	});
+}
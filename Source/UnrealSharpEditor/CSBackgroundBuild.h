@@ -0,0 +1,51 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+
+struct FCSManagedUnrealSharpEditorCallbacks;
+
+struct FCSBackgroundBuildResult
+{
+	bool bSucceeded = false;
+	FString ErrorMessage;
+
+	// Time of the last script save included in the build.
+	double LastChangeTime = 0.0;
+	double BuildSeconds = 0.0;
+};
+
+/**
+ * Builds and weaves the C# projects on a worker thread while scripts are being edited.
+ * Saves are coalesced: the build starts once no save arrived for the configured delay,
+ * and a save during a build cancels it so it restarts with the newer sources.
+ */
+class FCSBackgroundBuild
+{
+public:
+
+	DECLARE_DELEGATE_OneParam(FOnBuildFinished, const FCSBackgroundBuildResult&);
+
+	// Called on the game thread when a build finished without being cancelled.
+	FOnBuildFinished OnBuildFinished;
+
+	void NotifySourceChanged();
+
+	// Starts the build once the delay passed and reports finished builds. Game thread only.
+	void Tick(const FCSManagedUnrealSharpEditorCallbacks& Callbacks);
+
+	bool IsBuilding() const { return BuildResult.IsValid(); }
+
+	// Drops pending changes and waits for the build in flight, e.g. before building in the foreground.
+	void CancelAndWait(const FCSManagedUnrealSharpEditorCallbacks& Callbacks);
+
+private:
+
+	void StartBuild(const FCSManagedUnrealSharpEditorCallbacks& Callbacks);
+
+	TFuture<FCSBackgroundBuildResult> BuildResult;
+
+	double LastChangeTime = 0.0;
+	bool bHasPendingChanges = false;
+	bool bCancelRequested = false;
+};
@@ -0,0 +1,178 @@
+﻿#include "CSBlueprintDependencyIndex.h"
+#include "UnrealSharpCore/CSManager.h"
+#include "Editor.h"
+#include "K2Node.h"
+#include "K2Node_EditablePinBase.h"
+#include "Engine/Blueprint.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectIterator.h"
+
+void FCSBlueprintDependencyIndex::Initialize()
+{
+	AssetLoadedHandle = FCoreUObjectDelegates::OnAssetLoaded.AddRaw(this, &FCSBlueprintDependencyIndex::OnAssetLoaded);
+
+	// The editor engine doesn't exist yet when the editor module starts up.
+	if (GEditor)
+	{
+		RegisterCompileCallback();
+	}
+	else
+	{
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FCSBlueprintDependencyIndex::RegisterCompileCallback);
+	}
+
+	for (TObjectIterator<UBlueprint> BlueprintIt; BlueprintIt; ++BlueprintIt)
+	{
+		IndexBlueprint(*BlueprintIt);
+	}
+}
+
+void FCSBlueprintDependencyIndex::Shutdown()
+{
+	FCoreUObjectDelegates::OnAssetLoaded.Remove(AssetLoadedHandle);
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+
+	if (GEditor)
+	{
+		GEditor->OnBlueprintPreCompile().Remove(PreCompileHandle);
+	}
+
+	TypeToBlueprints.Reset();
+	BlueprintToTypes.Reset();
+}
+
+void FCSBlueprintDependencyIndex::RegisterCompileCallback()
+{
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	PreCompileHandle = GEditor->OnBlueprintPreCompile().AddRaw(this, &FCSBlueprintDependencyIndex::OnBlueprintPreCompile);
+}
+
+void FCSBlueprintDependencyIndex::OnAssetLoaded(UObject* Asset)
+{
+	if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+	{
+		IndexBlueprint(Blueprint);
+	}
+}
+
+void FCSBlueprintDependencyIndex::OnBlueprintPreCompile(UBlueprint* Blueprint)
+{
+	// Pins and variables may have changed since the Blueprint was last indexed.
+	IndexBlueprint(Blueprint);
+}
+
+void FCSBlueprintDependencyIndex::IndexBlueprint(UBlueprint* Blueprint)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBlueprintDependencyIndex::IndexBlueprint);
+
+	const TObjectKey<UBlueprint> BlueprintKey(Blueprint);
+	RemoveBlueprint(BlueprintKey);
+
+	TSet<TObjectKey<UField>> ManagedTypes;
+
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		AddManagedTypes(Variable.VarType, ManagedTypes);
+	}
+
+	TArray<UK2Node*> AllNodes;
+	FBlueprintEditorUtils::GetAllNodesOfClass<UK2Node>(Blueprint, AllNodes);
+
+	for (UK2Node* Node : AllNodes)
+	{
+		if (UK2Node_EditablePinBase* EditableNode = Cast<UK2Node_EditablePinBase>(Node))
+		{
+			for (const TSharedPtr<FUserPinInfo>& Pin : EditableNode->UserDefinedPins)
+			{
+				AddManagedTypes(Pin->PinType, ManagedTypes);
+			}
+		}
+
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			AddManagedTypes(Pin->PinType, ManagedTypes);
+		}
+	}
+
+	if (ManagedTypes.IsEmpty())
+	{
+		return;
+	}
+
+	for (const TObjectKey<UField>& ManagedType : ManagedTypes)
+	{
+		TypeToBlueprints.FindOrAdd(ManagedType).Add(BlueprintKey);
+	}
+
+	BlueprintToTypes.Add(BlueprintKey, ManagedTypes.Array());
+}
+
+TArray<UBlueprint*> FCSBlueprintDependencyIndex::FindDependentBlueprints(TConstArrayView<const UField*> Types) const
+{
+	TSet<TObjectKey<UBlueprint>> BlueprintKeys;
+	for (const UField* Type : Types)
+	{
+		if (const TSet<TObjectKey<UBlueprint>>* Blueprints = TypeToBlueprints.Find(Type))
+		{
+			BlueprintKeys.Append(*Blueprints);
+		}
+	}
+
+	TArray<UBlueprint*> Blueprints;
+	Blueprints.Reserve(BlueprintKeys.Num());
+
+	for (const TObjectKey<UBlueprint>& BlueprintKey : BlueprintKeys)
+	{
+		// Deleted Blueprints are left in the index until they are looked up.
+		UBlueprint* Blueprint = BlueprintKey.ResolveObjectPtr();
+		if (IsValid(Blueprint))
+		{
+			Blueprints.Add(Blueprint);
+		}
+	}
+
+	return Blueprints;
+}
+
+void FCSBlueprintDependencyIndex::RemoveBlueprint(const TObjectKey<UBlueprint>& BlueprintKey)
+{
+	TArray<TObjectKey<UField>> IndexedTypes;
+	if (!BlueprintToTypes.RemoveAndCopyValue(BlueprintKey, IndexedTypes))
+	{
+		return;
+	}
+
+	for (const TObjectKey<UField>& IndexedType : IndexedTypes)
+	{
+		if (TSet<TObjectKey<UBlueprint>>* Blueprints = TypeToBlueprints.Find(IndexedType))
+		{
+			Blueprints->Remove(BlueprintKey);
+			if (Blueprints->IsEmpty())
+			{
+				TypeToBlueprints.Remove(IndexedType);
+			}
+		}
+	}
+}
+
+void FCSBlueprintDependencyIndex::AddManagedTypes(const FEdGraphPinType& PinType, TSet<TObjectKey<UField>>& OutTypes)
+{
+	const UCSManager& Manager = UCSManager::Get();
+
+	auto AddType = [&Manager, &OutTypes](const UObject* TypeObject)
+	{
+		const UField* Field = Cast<UField>(TypeObject);
+		if (IsValid(Field) && Manager.IsManagedType(Field))
+		{
+			OutTypes.Add(Field);
+		}
+	};
+
+	AddType(PinType.PinSubCategoryObject.Get());
+
+	if (PinType.IsMap())
+	{
+		AddType(PinType.PinValueType.TerminalSubCategoryObject.Get());
+	}
+}
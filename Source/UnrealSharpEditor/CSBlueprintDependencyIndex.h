@@ -0,0 +1,41 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+struct FEdGraphPinType;
+
+/**
+ * Reverse index from managed types (UCSClass, UCSScriptStruct, UCSEnum) to the Blueprints that have pins or variables of those types.
+ * Kept up to date as Blueprints are loaded and compiled, so a hot reload only has to touch the Blueprints that use a rebuilt type.
+ */
+class FCSBlueprintDependencyIndex
+{
+public:
+
+	void Initialize();
+	void Shutdown();
+
+	// (Re)indexes the managed types the Blueprint references.
+	void IndexBlueprint(UBlueprint* Blueprint);
+
+	// Returns the Blueprints that reference any of the types.
+	TArray<UBlueprint*> FindDependentBlueprints(TConstArrayView<const UField*> Types) const;
+
+private:
+
+	void OnAssetLoaded(UObject* Asset);
+	void OnBlueprintPreCompile(UBlueprint* Blueprint);
+	void RegisterCompileCallback();
+
+	void RemoveBlueprint(const TObjectKey<UBlueprint>& BlueprintKey);
+	static void AddManagedTypes(const FEdGraphPinType& PinType, TSet<TObjectKey<UField>>& OutTypes);
+
+	TMap<TObjectKey<UField>, TSet<TObjectKey<UBlueprint>>> TypeToBlueprints;
+	TMap<TObjectKey<UBlueprint>, TArray<TObjectKey<UField>>> BlueprintToTypes;
+
+	FDelegateHandle AssetLoadedHandle;
+	FDelegateHandle PreCompileHandle;
+	FDelegateHandle PostEngineInitHandle;
+};
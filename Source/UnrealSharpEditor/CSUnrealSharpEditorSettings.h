@@ -56,6 +56,14 @@ public:
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
 	TEnumAsByte<EAutomaticHotReloadMethod> AutomaticHotReloading = OnScriptSave;
 
+	// With OnScriptSave, build in the background when scripts are saved and only reload once the build is done, instead of building behind a modal dialog.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload", meta = (EditCondition = "AutomaticHotReloading == EAutomaticHotReloadMethod::OnScriptSave"))
+	bool bBuildInBackground = true;
+
+	// How long to wait after the last script save before the background build starts. Saves within this window are built together.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload", meta = (EditCondition = "bBuildInBackground", ClampMin = "0.0", Units = "s"))
+	float BackgroundBuildDelay = 0.3f;
+
 	// The build configuration to use when building the C# project in the editor.
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
 	TEnumAsByte<ECSBuildConfiguration> BuildConfiguration = ECSBuildConfiguration::Debug;
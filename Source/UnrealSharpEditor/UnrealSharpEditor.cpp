@@ -67,6 +67,9 @@ void FUnrealSharpEditorModule::StartupModule()
 
 	FEditorDelegates::ShutdownPIE.AddRaw(this, &FUnrealSharpEditorModule::OnPIEShutdown);
 
+	BlueprintDependencyIndex.Initialize();
+	BackgroundBuild.OnBuildFinished.BindRaw(this, &FUnrealSharpEditorModule::OnBackgroundBuildFinished);
+
 	TickDelegate = FTickerDelegate::CreateRaw(this, &FUnrealSharpEditorModule::Tick);
 	TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(TickDelegate);
 
@@ -102,6 +105,13 @@ void FUnrealSharpEditorModule::StartupModule()
 void FUnrealSharpEditorModule::ShutdownModule()
 {
 	FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
+	BlueprintDependencyIndex.Shutdown();
+
+	if (ManagedUnrealSharpEditorCallbacks.CancelBuild)
+	{
+		BackgroundBuild.CancelAndWait(ManagedUnrealSharpEditorCallbacks);
+	}
+
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
     UnregisterPluginTemplates();
@@ -159,6 +169,12 @@ void FUnrealSharpEditorModule::OnCSharpCodeModified(const TArray<FFileChangeData
 		{
 			HotReloadStatus = PendingReload;
 		}
+		else if (Settings->bBuildInBackground)
+		{
+			// The build starts once the saves settle, the reload once it succeeded.
+			HotReloadStatus = PendingReload;
+			BackgroundBuild.NotifySourceChanged();
+		}
 		else
 		{
 			StartHotReload(true);
@@ -168,7 +184,7 @@ void FUnrealSharpEditorModule::OnCSharpCodeModified(const TArray<FFileChangeData
 	}
 }
 
-void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerWithNewProject)
+void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerWithNewProject, bool bAlreadyBuilt)
 {
 	if (HotReloadStatus == FailedToUnload)
 	{
@@ -204,8 +220,15 @@ void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerW
 	FString BuildConfiguration = Settings->GetBuildConfigurationString();
 	ECSLoggerVerbosity LogVerbosity = Settings->LogVerbosity;
 
+	if (!bAlreadyBuilt)
+	{
+		// The background build would race the foreground one for the build manager and the output files.
+		BackgroundBuild.CancelAndWait(ManagedUnrealSharpEditorCallbacks);
+		ManagedUnrealSharpEditorCallbacks.ResetCancelBuild();
+	}
+
 	FString ExceptionMessage;
-	if (!ManagedUnrealSharpEditorCallbacks.Build(*SolutionPath, *OutputPath, *BuildConfiguration, LogVerbosity, &ExceptionMessage, bRebuild))
+	if (!bAlreadyBuilt && !ManagedUnrealSharpEditorCallbacks.Build(*SolutionPath, *OutputPath, *BuildConfiguration, LogVerbosity, &ExceptionMessage, bRebuild))
 	{
 	 	HotReloadStatus = Inactive;
 		bHotReloadFailed = true;
@@ -218,15 +241,16 @@ void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerW
 
 	TArray<FString> ProjectsByLoadOrder;
 	FCSProcHelper::GetProjectNamesByLoadOrder(ProjectsByLoadOrder, true);
+	const TArray<FString> ProjectsToReload = FindProjectsToReload(ProjectsByLoadOrder);
 	
-	// Unload all assemblies in reverse order to prevent unloading an assembly that is still being referenced.
+	// Unload the assemblies in reverse order to prevent unloading an assembly that is still being referenced.
 	// For instance, most assemblies depend on ProjectGlue, so it must be unloaded last.
 	// Good info: https://learn.microsoft.com/en-us/dotnet/standard/assembly/unloadability
 	// Note: An assembly is only referenced if any of its types are referenced in code.
 	// Otherwise optimized out, so ProjectGlue can be unloaded first if it's not used.
-	for (int32 i = ProjectsByLoadOrder.Num() - 1; i >= 0; --i)
+	for (int32 i = ProjectsToReload.Num() - 1; i >= 0; --i)
 	{
-		const FString& ProjectName = ProjectsByLoadOrder[i];
+		const FString& ProjectName = ProjectsToReload[i];
 		UCSAssembly* Assembly = CSharpManager.FindAssembly(*ProjectName);
 
 		if (IsValid(Assembly) && !Assembly->UnloadAssembly())
@@ -250,8 +274,8 @@ void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerW
 		return;
 	}
 
-	// Load all assemblies again in the correct order.
-	for (const FString& ProjectName : ProjectsByLoadOrder)
+	// Load the assemblies again in the correct order.
+	for (const FString& ProjectName : ProjectsToReload)
 	{
 		UCSAssembly* Assembly = CSharpManager.FindAssembly(*ProjectName);
 
@@ -275,6 +299,62 @@ void FUnrealSharpEditorModule::StartHotReload(bool bRebuild, bool bPromptPlayerW
 	UE_LOG(LogUnrealSharpEditor, Log, TEXT("Hot reload took %.2f seconds to execute"), FPlatformTime::Seconds() - StartTime);
 }
 
+TArray<FString> FUnrealSharpEditorModule::FindProjectsToReload(const TArray<FString>& ProjectsByLoadOrder)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealSharpEditorModule::FindProjectsToReload);
+
+	UCSManager& CSharpManager = UCSManager::Get();
+
+	TMap<FString, TArray<FString>> ProjectDependencies;
+	FCSProcHelper::GetProjectDependencies(ProjectDependencies);
+
+	TArray<FString> ProjectsToReload;
+	TSet<FString> ReloadedProjects;
+
+	for (const FString& ProjectName : ProjectsByLoadOrder)
+	{
+		UCSAssembly* Assembly = CSharpManager.FindAssembly(*ProjectName);
+		FString Reason;
+
+		if (!IsValid(Assembly) || !Assembly->IsValidAssembly())
+		{
+			Reason = TEXT("not loaded yet");
+		}
+		else if (Assembly->ComputeFileHash() != Assembly->GetFileHash())
+		{
+			Reason = TEXT("assembly or metadata changed");
+		}
+		else if (const TArray<FString>* Dependencies = ProjectDependencies.Find(ProjectName))
+		{
+			for (const FString& Dependency : *Dependencies)
+			{
+				if (ReloadedProjects.Contains(Dependency))
+				{
+					Reason = FString::Printf(TEXT("depends on %s"), *Dependency);
+					break;
+				}
+			}
+		}
+		else if (!ReloadedProjects.IsEmpty())
+		{
+			// Without dependency information, anything loaded after a reloaded assembly may reference it.
+			Reason = TEXT("loaded after a reloaded assembly");
+		}
+
+		if (Reason.IsEmpty())
+		{
+			UE_LOGFMT(LogUnrealSharpEditor, Log, "Skipping {0}: unchanged.", *ProjectName);
+			continue;
+		}
+
+		UE_LOGFMT(LogUnrealSharpEditor, Log, "Reloading {0}: {1}.", *ProjectName, *Reason);
+		ReloadedProjects.Add(ProjectName);
+		ProjectsToReload.Add(ProjectName);
+	}
+
+	return ProjectsToReload;
+}
+
 void FUnrealSharpEditorModule::InitializeUnrealSharpEditorCallbacks(FCSManagedUnrealSharpEditorCallbacks Callbacks)
 {
 	ManagedUnrealSharpEditorCallbacks = Callbacks;
@@ -751,6 +831,11 @@ bool FUnrealSharpEditorModule::Tick(float DeltaTime)
 		StartHotReload();
 	}
 
+	if (ManagedUnrealSharpEditorCallbacks.Build)
+	{
+		BackgroundBuild.Tick(ManagedUnrealSharpEditorCallbacks);
+	}
+
 	return true;
 }
 
@@ -853,6 +938,33 @@ void FUnrealSharpEditorModule::OnPIEShutdown(bool IsSimulating)
 	}
 }
 
+void FUnrealSharpEditorModule::OnBackgroundBuildFinished(const FCSBackgroundBuildResult& Result)
+{
+	if (!Result.bSucceeded)
+	{
+		HotReloadStatus = Inactive;
+		bHotReloadFailed = true;
+		UE_LOGFMT(LogUnrealSharpEditor, Error, "Background build failed: {0}", *Result.ErrorMessage);
+
+		FNotificationInfo Info(LOCTEXT("BackgroundBuildFailed", "Building C# failed. See the output log for details."));
+		Info.ExpireDuration = 5.0f;
+		Info.bFireAndForget = true;
+		FSlateNotificationManager::Get().AddNotification(Info)->SetCompletionState(SNotificationItem::CS_Fail);
+		return;
+	}
+
+	if (FPlayWorldCommandCallbacks::IsInPIE())
+	{
+		bHasQueuedHotReload = true;
+		return;
+	}
+
+	StartHotReload(false, true, true);
+
+	UE_LOGFMT(LogUnrealSharpEditor, Log, "Reloaded C# {0} seconds after the last script save ({1} seconds building in the background).",
+		FPlatformTime::Seconds() - Result.LastChangeTime, Result.BuildSeconds);
+}
+
 void FUnrealSharpEditorModule::AddNewProject(const FString& ModuleName, const FString& ProjectParentFolder, const FString& ProjectRoot, const TMap<FString, FString>& ExtraArguments)
 {
 	TMap<FString, FString> Arguments = ExtraArguments;
@@ -934,14 +1046,13 @@ void FUnrealSharpEditorModule::OnEnumRebuilt(UCSEnum* NewEnum)
 
 bool FUnrealSharpEditorModule::IsPinAffectedByReload(const FEdGraphPinType& PinType) const
 {
-	UObject* PinSubCategoryObject = PinType.PinSubCategoryObject.Get();
-	if (!IsValid(PinSubCategoryObject) || !Manager->IsManagedType(PinSubCategoryObject))
-	{
-		return false;
-	}
-
 	auto IsPinTypeRebuilt = [this](UObject* PinSubCategoryObject) -> bool
 	{
+		if (!IsValid(PinSubCategoryObject) || !Manager->IsManagedType(PinSubCategoryObject))
+		{
+			return false;
+		}
+
 		if (UCSClass* Class = Cast<UCSClass>(PinSubCategoryObject))
 		{
 			return RebuiltClasses.Contains(Class);
@@ -957,29 +1068,15 @@ bool FUnrealSharpEditorModule::IsPinAffectedByReload(const FEdGraphPinType& PinT
 			return RebuiltStructs.Contains(Struct);
 		}
 
-		if (UCSEnum* Enum = Cast<UCSEnum>(PinSubCategoryObject))
-		{
-			return RebuiltEnums.Contains(Enum);
-		}
-
 		return false;
 	};
 
-	if (!IsPinTypeRebuilt(PinSubCategoryObject))
+	if (IsPinTypeRebuilt(PinType.PinSubCategoryObject.Get()))
 	{
-		return false;
+		return true;
 	}
 
-	if (PinType.IsMap() && PinType.PinValueType.TerminalSubCategoryObject.IsValid())
-	{
-		UObject* MapValueType = PinType.PinValueType.TerminalSubCategoryObject.Get();
-		if (IsValid(MapValueType) && Manager->IsManagedType(MapValueType))
-		{
-			return IsPinTypeRebuilt(MapValueType);
-		}
-	}
-
-	return false;
+	return PinType.IsMap() && IsPinTypeRebuilt(PinType.PinValueType.TerminalSubCategoryObject.Get());
 }
 
 bool FUnrealSharpEditorModule::IsNodeAffectedByReload(UEdGraphNode* Node) const
@@ -1039,13 +1136,20 @@ void FUnrealSharpEditorModule::RefreshAffectedBlueprints()
 		return;
 	}
 
+	TRACE_CPUPROFILER_EVENT_SCOPE(FUnrealSharpEditorModule::RefreshAffectedBlueprints);
+
+	TArray<const UField*> RebuiltTypes;
+	RebuiltTypes.Reserve(RebuiltStructs.Num() + RebuiltClasses.Num() + RebuiltEnums.Num());
+	RebuiltTypes.Append(RebuiltStructs.Array());
+	RebuiltTypes.Append(RebuiltClasses.Array());
+	RebuiltTypes.Append(RebuiltEnums.Array());
+
 	TArray<UBlueprint*> AffectedBlueprints;
-	for (TObjectIterator<UBlueprint> BlueprintIt; BlueprintIt; ++BlueprintIt)
+	for (UBlueprint* Blueprint : BlueprintDependencyIndex.FindDependentBlueprints(RebuiltTypes))
 	{
-		UBlueprint* Blueprint = *BlueprintIt;
 		if (!IsValid(Blueprint->GeneratedClass) || FCSClassUtilities::IsManagedClass(Blueprint->GeneratedClass))
 		{
-			return;
+			continue;
 		}
 
 		TArray<UK2Node*> AllNodes;
@@ -1067,6 +1171,8 @@ void FUnrealSharpEditorModule::RefreshAffectedBlueprints()
 		FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
 	}
 
+	UE_LOGFMT(LogUnrealSharpEditor, Log, "Recompiled {0} Blueprints affected by {1} rebuilt types.", AffectedBlueprints.Num(), RebuiltTypes.Num());
+
 	RebuiltStructs.Reset();
 	RebuiltClasses.Reset();
 	RebuiltEnums.Reset();
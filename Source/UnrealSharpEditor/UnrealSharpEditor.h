@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 #include "Containers/Ticker.h"
+#include "CSBackgroundBuild.h"
+#include "CSBlueprintDependencyIndex.h"
 
 #ifdef __clang__
 #pragma clang diagnostic ignored "-Wignored-attributes"
@@ -33,7 +35,7 @@ enum HotReloadStatus
 
 struct FCSManagedUnrealSharpEditorCallbacks
 {
-    FCSManagedUnrealSharpEditorCallbacks() : Build(nullptr), ForceManagedGC(nullptr), OpenSolution(nullptr), AddProjectToCollection(nullptr)
+    FCSManagedUnrealSharpEditorCallbacks() : Build(nullptr), ForceManagedGC(nullptr), OpenSolution(nullptr), AddProjectToCollection(nullptr), CancelBuild(nullptr), ResetCancelBuild(nullptr)
     {
     }
 
@@ -41,11 +43,19 @@ struct FCSManagedUnrealSharpEditorCallbacks
     using FForceManagedGC = void(__stdcall*)();
     using FOpenSolution = bool(__stdcall*)(const TCHAR*, void*);
     using FAddProjectToCollection = void(__stdcall*)(const TCHAR*);
+    using FCancelBuild = void(__stdcall*)();
+    using FResetCancelBuild = void(__stdcall*)();
 
     FBuildProject Build;
     FForceManagedGC ForceManagedGC;
     FOpenSolution OpenSolution;
     FAddProjectToCollection AddProjectToCollection;
+
+    // Cancels the build running on another thread. Build then returns false.
+    FCancelBuild CancelBuild;
+
+    // Clears a previous cancellation. Called on the game thread before a build is started, so a cancel sent right after isn't lost.
+    FResetCancelBuild ResetCancelBuild;
 };
 
 
@@ -62,7 +72,8 @@ public:
     // End
 
     void OnCSharpCodeModified(const TArray<struct FFileChangeData>& ChangedFiles);
-    void StartHotReload(bool bRebuild = true, bool bPromptPlayerWithNewProject = true);
+    // bAlreadyBuilt skips building and weaving, for assemblies that were built in the background.
+    void StartHotReload(bool bRebuild = true, bool bPromptPlayerWithNewProject = true, bool bAlreadyBuilt = false);
 
     void InitializeUnrealSharpEditorCallbacks(FCSManagedUnrealSharpEditorCallbacks Callbacks);
 
@@ -124,6 +135,8 @@ private:
 
     void OnPIEShutdown(bool IsSimulating);
 
+    void OnBackgroundBuildFinished(const FCSBackgroundBuildResult& Result);
+
     void OnStructRebuilt(UCSScriptStruct* NewStruct);
     void OnClassRebuilt(UCSClass* NewClass);
     void OnEnumRebuilt(UCSEnum* NewEnum);
@@ -133,6 +146,9 @@ private:
     
     void RefreshAffectedBlueprints();
 
+    // Projects whose assembly or metadata changed since they were loaded, or that depend on one that did. In load order.
+    static TArray<FString> FindProjectsToReload(const TArray<FString>& ProjectsByLoadOrder);
+
     FSlateIcon GetMenuIcon() const;
 
     FCSManagedUnrealSharpEditorCallbacks ManagedUnrealSharpEditorCallbacks;
@@ -151,6 +167,9 @@ private:
     TSet<UCSClass*> RebuiltClasses;
     TSet<UCSEnum*> RebuiltEnums;
 
+    FCSBlueprintDependencyIndex BlueprintDependencyIndex;
+    FCSBackgroundBuild BackgroundBuild;
+
     UCSManager* Manager = nullptr;
     TArray<FString> WatchingDirectories;
 };
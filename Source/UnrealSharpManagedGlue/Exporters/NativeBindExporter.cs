@@ -143,7 +143,7 @@ public static class NativeBindExporter
                 {
                     string functionReference = $"{topType.SourceName}::{method.MethodName}";
                     builder.AppendLine($"const FCSExportedFunction {typeName}::UnrealSharpBind_{method.MethodName}");
-                    builder.Append($" = FCSExportedFunction(\"{topType.EngineName}\", \"{method.MethodName}\", (void*)&{functionReference}, GetFunctionSize({functionReference}));");
+                    builder.Append($" = MakeExportedFunction<&{functionReference}>(\"{topType.EngineName}\", \"{method.MethodName}\");");
                 }
                 
                 builder.AppendLine();
@@ -0,0 +1,159 @@
+#include "CSBuildToolServer.h"
+#include "CSProcHelper.h"
+#include "UnrealSharpProcHelper.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	FString ToJsonArray(const TArray<FString>& Arguments)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		for (const FString& Argument : Arguments)
+		{
+			Values.Add(MakeShared<FJsonValueString>(Argument));
+		}
+
+		FString Json;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+		FJsonSerializer::Serialize(Values, Writer);
+		return Json;
+	}
+}
+
+FCSBuildToolServer& FCSBuildToolServer::Get()
+{
+	static FCSBuildToolServer Server;
+	return Server;
+}
+
+bool FCSBuildToolServer::Invoke(const TArray<FString>& ServerArguments, const TArray<FString>& RequestArguments, int32& OutReturnCode, FString& OutOutput)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBuildToolServer::Invoke);
+	FScopeLock ScopeLock(&Lock);
+
+	if (!IsRunning() && !StartServer(ServerArguments))
+	{
+		return false;
+	}
+
+	if (!WriteLine(ToJsonArray(RequestArguments)) || !ReadResponse(OutReturnCode, OutOutput))
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("UnrealSharpBuildTool server stopped responding, restarting it on the next request."));
+		Shutdown();
+		return false;
+	}
+
+	return true;
+}
+
+bool FCSBuildToolServer::StartServer(const TArray<FString>& ServerArguments)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FCSBuildToolServer::StartServer);
+
+	if (!FPlatformProcess::CreatePipe(StdOutRead, StdOutWrite) || !FPlatformProcess::CreatePipe(StdInRead, StdInWrite, true))
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("Failed to create pipes for the UnrealSharpBuildTool server."));
+		Shutdown();
+		return false;
+	}
+
+	FString Args = TEXT("--Action Server");
+	for (const FString& Argument : ServerArguments)
+	{
+		Args += TEXT(" ") + Argument;
+	}
+
+	const FString BuildToolPath = FCSProcHelper::GetUnrealSharpBuildToolPath();
+	const FString WorkingDirectory = FCSProcHelper::GetPluginAssembliesPath();
+	ProcessHandle = FPlatformProcess::CreateProc(*BuildToolPath, *Args, false, true, true, nullptr, 0, *WorkingDirectory, StdOutWrite, StdInRead);
+
+	if (!ProcessHandle.IsValid())
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("Failed to start the UnrealSharpBuildTool server at %s."), *BuildToolPath);
+		Shutdown();
+		return false;
+	}
+
+	UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("Started UnrealSharpBuildTool server."));
+	return true;
+}
+
+bool FCSBuildToolServer::IsRunning()
+{
+	return ProcessHandle.IsValid() && FPlatformProcess::IsProcRunning(ProcessHandle);
+}
+
+bool FCSBuildToolServer::WriteLine(const FString& Line)
+{
+	FTCHARToUTF8 Utf8Line(*(Line + TEXT("\n")));
+	int32 BytesWritten = 0;
+	return FPlatformProcess::WritePipe(StdInWrite, reinterpret_cast<const uint8*>(Utf8Line.Get()), Utf8Line.Length(), &BytesWritten) && BytesWritten == Utf8Line.Length();
+}
+
+bool FCSBuildToolServer::ReadResponse(int32& OutReturnCode, FString& OutOutput)
+{
+	const int32 ResultPrefixLength = FCString::Strlen(ResultPrefix);
+
+	while (true)
+	{
+		const bool bIsRunning = IsRunning();
+
+		TArray<uint8> Bytes;
+		if (FPlatformProcess::ReadPipeToArray(StdOutRead, Bytes))
+		{
+			PendingOutput.Append(Bytes);
+		}
+
+		// Split on the raw bytes so multi-byte characters cut between two reads are decoded whole.
+		int32 LineEnd;
+		while (PendingOutput.Find('\n', LineEnd))
+		{
+			FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(PendingOutput.GetData()), LineEnd);
+			FString Line(Converted.Length(), Converted.Get());
+			PendingOutput.RemoveAt(0, LineEnd + 1);
+			Line.TrimEndInline();
+
+			if (Line.StartsWith(ResultPrefix))
+			{
+				OutReturnCode = FCString::Atoi(*Line + ResultPrefixLength);
+				return true;
+			}
+
+			UE_LOG(LogUnrealSharpProcHelper, Display, TEXT("%s"), *Line);
+			OutOutput += Line + TEXT("\n");
+		}
+
+		if (!bIsRunning)
+		{
+			// Everything the process wrote before exiting has been read by now.
+			return false;
+		}
+
+		FPlatformProcess::Sleep(0.01f);
+	}
+}
+
+void FCSBuildToolServer::Shutdown()
+{
+	if (ProcessHandle.IsValid())
+	{
+		if (FPlatformProcess::IsProcRunning(ProcessHandle))
+		{
+			WriteLine(TEXT("exit"));
+			FPlatformProcess::Sleep(0.1f);
+
+			if (FPlatformProcess::IsProcRunning(ProcessHandle))
+			{
+				FPlatformProcess::TerminateProc(ProcessHandle, true);
+			}
+		}
+
+		FPlatformProcess::CloseProc(ProcessHandle);
+	}
+
+	FPlatformProcess::ClosePipe(StdOutRead, StdOutWrite);
+	FPlatformProcess::ClosePipe(StdInRead, StdInWrite);
+	StdOutRead = StdOutWrite = StdInRead = StdInWrite = nullptr;
+	PendingOutput.Reset();
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+
+/**
+ * Long-lived UnrealSharpBuildTool process that runs build tool actions sent over its standard input.
+ * Keeps the dotnet host and the build tool warm between actions, instead of paying startup and JIT for every invocation.
+ * Output is forwarded to the log line by line while the action runs.
+ */
+class UNREALSHARPPROCHELPER_API FCSBuildToolServer
+{
+public:
+
+	// Printed by the server after each request, followed by the exit code of the action.
+	static constexpr const TCHAR* ResultPrefix = TEXT("##UnrealSharpBuildToolResult ");
+
+	static FCSBuildToolServer& Get();
+
+	// Runs the action in the server process, starting it if needed.
+	// Returns false if the server couldn't run the request, in which case the caller should fall back to a one-shot process.
+	bool Invoke(const TArray<FString>& ServerArguments, const TArray<FString>& RequestArguments, int32& OutReturnCode, FString& OutOutput);
+
+	void Shutdown();
+
+private:
+
+	bool StartServer(const TArray<FString>& ServerArguments);
+	bool IsRunning();
+	bool WriteLine(const FString& Line);
+
+	// Reads the output of the current request until the result line. Returns false if the server exited before that.
+	bool ReadResponse(int32& OutReturnCode, FString& OutOutput);
+
+	FProcHandle ProcessHandle;
+
+	void* StdOutRead = nullptr;
+	void* StdOutWrite = nullptr;
+	void* StdInRead = nullptr;
+	void* StdInWrite = nullptr;
+
+	// Output that was read from the pipe but isn't a complete line yet.
+	TArray<uint8> PendingOutput;
+
+	// Requests are sent one at a time, the server runs them in order.
+	FCriticalSection Lock;
+};
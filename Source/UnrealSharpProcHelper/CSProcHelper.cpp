@@ -6,6 +6,13 @@
 #include "Misc/Paths.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/MessageDialog.h"
+#include "CSBuildToolServer.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarUseBuildToolServer(
+	TEXT("UnrealSharp.BuildToolServer"),
+	true,
+	TEXT("Run UnrealSharpBuildTool actions in a long-lived server process instead of starting a new process for each action."));
 
 bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, const FString* InWorkingDirectory)
 {
@@ -16,9 +23,14 @@ bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arg
 	FString ErrorMessage;
 	FPlatformProcess::ExecProcess(*ProgramPath, *Arguments, &OutReturnCode, &Output, &ErrorMessage, *WorkingDirectory);
 
-	if (OutReturnCode != 0)
+	return HandleCommandResult(ProgramName, Arguments, OutReturnCode, Output, StartTime);
+}
+
+bool FCSProcHelper::HandleCommandResult(const FString& ProgramName, const FString& Arguments, int32 ReturnCode, const FString& Output, double StartTime)
+{
+	if (ReturnCode != 0)
 	{
-		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s task failed (Args: %s) with return code %d. Error: %s"), *ProgramName, *Arguments, OutReturnCode, *Output)
+		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s task failed (Args: %s) with return code %d. Error: %s"), *ProgramName, *Arguments, ReturnCode, *Output)
 
 		FText DialogText = FText::FromString(FString::Printf(TEXT("%s task failed: \n %s"), *ProgramName, *Output));
 		FMessageDialog::Open(EAppMsgType::Ok, DialogText);
@@ -31,28 +43,64 @@ bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arg
 	return true;
 }
 
+FString FCSProcHelper::QuoteArgument(const FString& Argument)
+{
+	return Argument.Contains(TEXT(" ")) ? FString::Printf(TEXT("\"%s\""), *Argument) : Argument;
+}
+
 bool FCSProcHelper::InvokeUnrealSharpBuildTool(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments)
 {
 	FString PluginFolder = FPaths::ConvertRelativePathToFull(IPluginManager::Get().FindPlugin(UE_PLUGIN_NAME)->GetBaseDir());
 	FString DotNetPath = GetDotNetExecutablePath();
 
-	FString Args;
-	Args += FString::Printf(TEXT(" --Action %s"), *BuildAction);
-	Args += FString::Printf(TEXT(" --EngineDirectory \"%s\""), *FPaths::ConvertRelativePathToFull(FPaths::EngineDir()));
-	Args += FString::Printf(TEXT(" --ProjectDirectory \"%s\""), *FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()));
-	Args += FString::Printf(TEXT(" --ProjectName %s"), FApp::GetProjectName());
-	Args += FString::Printf(TEXT(" --PluginDirectory \"%s\""), *PluginFolder);
-	Args += FString::Printf(TEXT(" --DotNetPath \"%s\""), *DotNetPath);
+	// Arguments that stay the same for the whole editor session, the build tool server is started with these.
+	TArray<FString> SessionArguments =
+	{
+		TEXT("--EngineDirectory"), FPaths::ConvertRelativePathToFull(FPaths::EngineDir()),
+		TEXT("--ProjectDirectory"), FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()),
+		TEXT("--ProjectName"), FApp::GetProjectName(),
+		TEXT("--PluginDirectory"), PluginFolder,
+		TEXT("--DotNetPath"), DotNetPath,
+	};
+
+	TArray<FString> RequestArguments = { TEXT("--Action"), BuildAction };
+	RequestArguments.Append(SessionArguments);
 
 	if (AdditionalArguments.Num())
 	{
-		Args += TEXT(" --AdditionalArgs");
+		RequestArguments.Add(TEXT("--AdditionalArgs"));
 		for (const TPair<FString, FString>& Argument : AdditionalArguments)
 		{
-			Args += FString::Printf(TEXT(" %s=%s"), *Argument.Key, *Argument.Value);
+			RequestArguments.Add(FString::Printf(TEXT("%s=%s"), *Argument.Key, *Argument.Value));
 		}
 	}
 
+	if (CVarUseBuildToolServer.GetValueOnAnyThread())
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		TArray<FString> ServerArguments;
+		for (const FString& Argument : SessionArguments)
+		{
+			ServerArguments.Add(QuoteArgument(Argument));
+		}
+
+		int32 ReturnCode = 0;
+		FString Output;
+		if (FCSBuildToolServer::Get().Invoke(ServerArguments, RequestArguments, ReturnCode, Output))
+		{
+			return HandleCommandResult(TEXT("UnrealSharpBuildTool"), BuildAction, ReturnCode, Output, StartTime);
+		}
+
+		UE_LOG(LogUnrealSharpProcHelper, Warning, TEXT("UnrealSharpBuildTool server couldn't run %s, falling back to a new process."), *BuildAction);
+	}
+
+	FString Args;
+	for (const FString& Argument : RequestArguments)
+	{
+		Args += TEXT(" ") + QuoteArgument(Argument);
+	}
+
 	int32 ReturnCode = 0;
 	FString Output;
 	FString WorkingDirectory = GetPluginAssembliesPath();
@@ -147,27 +195,38 @@ FString FCSProcHelper::GetUnrealSharpMetadataPath()
 	return FPaths::Combine(GetUserAssemblyDirectory(), "UnrealSharp.assemblyloadorder.json");
 }
 
-void FCSProcHelper::GetProjectNamesByLoadOrder(TArray<FString>& UserProjectNames, const bool bIncludeGlue)
+static TSharedPtr<FJsonObject> LoadUnrealSharpMetadata()
 {
-	const FString ProjectMetadataPath = GetUnrealSharpMetadataPath();
+	const FString ProjectMetadataPath = FCSProcHelper::GetUnrealSharpMetadataPath();
 
 	if (!FPaths::FileExists(ProjectMetadataPath))
 	{
 		// Can be null at the start of the project.
-		return;
+		return nullptr;
 	}
 
 	FString JsonString;
 	if (!FFileHelper::LoadFileToString(JsonString, *ProjectMetadataPath))
 	{
 		UE_LOG(LogUnrealSharpProcHelper, Fatal, TEXT("Failed to load UnrealSharp metadata file at: %s"), *ProjectMetadataPath);
-		return;
+		return nullptr;
 	}
 
 	TSharedPtr<FJsonObject> JsonObject;
 	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject.IsValid())
 	{
 		UE_LOG(LogUnrealSharpProcHelper, Fatal, TEXT("Failed to parse UnrealSharp metadata at: %s"), *ProjectMetadataPath);
+		return nullptr;
+	}
+
+	return JsonObject;
+}
+
+void FCSProcHelper::GetProjectNamesByLoadOrder(TArray<FString>& UserProjectNames, const bool bIncludeGlue)
+{
+	TSharedPtr<FJsonObject> JsonObject = LoadUnrealSharpMetadata();
+	if (!JsonObject.IsValid())
+	{
 		return;
 	}
 
@@ -199,6 +258,26 @@ void FCSProcHelper::GetAssemblyPathsByLoadOrder(TArray<FString>& AssemblyPaths,
 	}
 }
 
+void FCSProcHelper::GetProjectDependencies(TMap<FString, TArray<FString>>& OutDependencies)
+{
+	TSharedPtr<FJsonObject> JsonObject = LoadUnrealSharpMetadata();
+	const TSharedPtr<FJsonObject>* DependenciesObject;
+	
+	if (!JsonObject.IsValid() || !JsonObject->TryGetObjectField(TEXT("AssemblyDependencies"), DependenciesObject))
+	{
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : (*DependenciesObject)->Values)
+	{
+		TArray<FString>& Dependencies = OutDependencies.Add(Entry.Key);
+		for (const TSharedPtr<FJsonValue>& Dependency : Entry.Value->AsArray())
+		{
+			Dependencies.Add(Dependency->AsString());
+		}
+	}
+}
+
 void FCSProcHelper::GetAllProjectPaths(TArray<FString>& ProjectPaths, bool bIncludeProjectGlue)
 {
 	// Use the FileManager to find files matching the pattern
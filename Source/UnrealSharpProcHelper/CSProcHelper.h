@@ -29,6 +29,11 @@ public:
 	static bool InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, const FString* InWorkingDirectory = nullptr);
 	static bool InvokeUnrealSharpBuildTool(const FString& BuildAction, const TMap<FString, FString>& AdditionalArguments = TMap<FString, FString>());
 
+	// Logs the result of a finished command and shows a dialog if it failed.
+	static bool HandleCommandResult(const FString& ProgramName, const FString& Arguments, int32 ReturnCode, const FString& Output, double StartTime);
+
+	static FString QuoteArgument(const FString& Argument);
+
 	static FString GetRuntimeConfigPath();
 
 	static FString GetPluginAssembliesPath();
@@ -49,6 +54,9 @@ public:
 	// Same as GetProjectNamesByLoadOrder, but returns the paths to the assemblies instead.
 	static void GetAssemblyPathsByLoadOrder(TArray<FString>& AssemblyPaths, bool bIncludeGlue = false);
 
+	// Gets the user assemblies each project references, by project name. Empty if the metadata was written by an older weaver.
+	static void GetProjectDependencies(TMap<FString, TArray<FString>>& OutDependencies);
+
 	// Gets all the project paths in the /Scripts directory.
 	static void GetAllProjectPaths(TArray<FString>& ProjectPaths, bool bIncludeProjectGlue = false);
 
@@ -1,5 +1,6 @@
 ﻿#include "UnrealSharpProcHelper.h"
 
+#include "CSBuildToolServer.h"
 #include "CSProcHelper.h"
 
 #define LOCTEXT_NAMESPACE "FUnrealSharpProcHelperModule"
@@ -13,7 +14,7 @@ void FUnrealSharpProcHelperModule::StartupModule()
 
 void FUnrealSharpProcHelperModule::ShutdownModule()
 {
-    
+    FCSBuildToolServer::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE